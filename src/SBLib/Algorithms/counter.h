@@ -1,38 +1,76 @@
 #pragma once
+#include <cstddef>
+#include <type_traits>
 
 namespace SBLib::Algorithms
 {
 namespace
 {
-	enum : size_t { max_counter_token_count = 128, max_counter_token_count_vs2017 = ((512 - 1) & ~15), };
-	static_assert( max_counter_token_count <= max_counter_token_count_vs2017, "VC 2017 compiler won't let you use that much counters. You should use __COUNTER__ instead." );
+	enum : size_t { max_counter_token_count = (1 << 12) - 1, };
 
 	template<size_t counter_value = max_counter_token_count> struct counter_token {};
+
+	//
+	// counter_flag / counter_constant
+	// is_counter_reached(counter_flag<counter_value>) is declared along with every flag, but only defined (as a friend) once
+	// counter_constant<counter_value> is instantiated : the reached values are always 0 (implicitly), 1, 2, ... up to the
+	// current counter value, which makes them searchable by bisection.
+	//
+	template<size_t counter_value> struct counter_flag
+	{
+		friend constexpr bool is_counter_reached(counter_flag<counter_value>);
+	};
 	template<size_t counter_value> struct counter_constant : std::integral_constant<size_t, counter_value>
 	{
-		inline constexpr friend size_t get_counter_value(counter_token<counter_value>)
+		friend constexpr bool is_counter_reached(counter_flag<counter_value>)
 		{
-			return counter_value;
+			return true;
 		}
 	};
 
-	template<int try_counter_value>
-	inline constexpr size_t get_counter_value(counter_token<try_counter_value>, size_t value = get_counter_value(counter_token<try_counter_value - 1>()))
+	//
+	// probe_counter_value
+	// low_value + step if that value has been reached, low_value otherwise : calling the undefined is_counter_reached is not a
+	// constant expression, which discards the first overload.
+	//
+	template<size_t low_value, size_t step, bool = is_counter_reached(counter_flag<low_value + step>())>
+	constexpr size_t probe_counter_value(int)
 	{
-		return value;
+		return low_value + step;
 	}
-	inline constexpr size_t get_counter_value(counter_token<0>)
+	template<size_t low_value, size_t step>
+	constexpr size_t probe_counter_value(long)
 	{
-		return 0;
+		return low_value;
 	}
 } // anonymous namespace
 
-template<int current_value = get_counter_value(counter_token<>())>
+//
+// get_counter
+// Compile-time counter : every call gets the next value. The current value is found by bisection, one probe per bit of
+// max_counter_token_count instead of one per token above the current value. Every probe is a default template argument : those
+// are evaluated again at each call, whereas a probe in a function body would only be evaluated once.
+// The next counter_constant is defined by a template argument rather than in the body, so that it happens at the call site
+// even when the compiler defers the instantiation of the body.
+//
+template<size_t low_value = 0,
+	size_t lookup_11 = probe_counter_value<low_value, (1 << 11)>(0),
+	size_t lookup_10 = probe_counter_value<lookup_11, (1 << 10)>(0),
+	size_t lookup_9  = probe_counter_value<lookup_10, (1 << 9)>(0),
+	size_t lookup_8  = probe_counter_value<lookup_9, (1 << 8)>(0),
+	size_t lookup_7  = probe_counter_value<lookup_8, (1 << 7)>(0),
+	size_t lookup_6  = probe_counter_value<lookup_7, (1 << 6)>(0),
+	size_t lookup_5  = probe_counter_value<lookup_6, (1 << 5)>(0),
+	size_t lookup_4  = probe_counter_value<lookup_5, (1 << 4)>(0),
+	size_t lookup_3  = probe_counter_value<lookup_4, (1 << 3)>(0),
+	size_t lookup_2  = probe_counter_value<lookup_3, (1 << 2)>(0),
+	size_t lookup_1  = probe_counter_value<lookup_2, (1 << 1)>(0),
+	size_t current_value = probe_counter_value<lookup_1, (1 << 0)>(0),
+	size_t next_value = counter_constant<current_value + 1>::value>
 inline constexpr size_t get_counter()
 {
-	constexpr auto value = counter_constant<current_value + 1>::value - 1; // force compiler to define next counter_constant
-	static_assert(value + 1 <= max_counter_token_count, "Max counter token reached. Increase max_counter_token_count if you need more.");
-	return value;
+	static_assert(next_value <= max_counter_token_count, "Max counter token reached. Add a lookup step to get_counter if you need more.");
+	return current_value;
 }
 } // namespace SBLib::Algorithms
 namespace SBLib { using namespace Algorithms; }
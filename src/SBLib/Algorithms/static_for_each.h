@@ -1,4 +1,8 @@
 #pragma once
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
 namespace SBLib::Algorithms
 {
 struct increment_index_helper
@@ -8,6 +12,10 @@ struct increment_index_helper
 	{
 		return index + 1;
 	}
+	static constexpr size_t get_next(size_t index)
+	{
+		return index + 1;
+	}
 };
 struct get_index_helper
 {
@@ -18,23 +26,117 @@ struct get_index_helper
 	}
 };
 
+//
+// static_recursive_for_each
+// Calls fct_type<get_helper::get<index>(), index>(types...) for index = begin, increment_helper::increment<begin>(), ... up to end,
+// one nested instantiation per element : the instantiation depth grows with the element count.
+//
 template<size_t begin, size_t end, class get_helper = get_index_helper, class increment_helper = increment_index_helper>
-struct static_for_each
+struct static_recursive_for_each
 {
 	template<template<size_t, size_t> typename fct_type, typename... type_t>
 	static void iterate(type_t&&... types)
 	{
-		fct_type<get_helper::get<begin>(), begin>(types...);
-		static_for_each<increment_helper::increment<begin>(), end, get_helper, increment_helper>::iterate<fct_type>(types...);
+		fct_type<get_helper::template get<begin>(), begin>(types...);
+		static_recursive_for_each<increment_helper::template increment<begin>(), end, get_helper, increment_helper>::template iterate<fct_type>(types...);
 	}
 };
 template<size_t end, class get_helper, class increment_helper>
-struct static_for_each<end, end, get_helper, increment_helper>
+struct static_recursive_for_each<end, end, get_helper, increment_helper>
 {
 	template<template<size_t, size_t> class fct_type, typename... type_t>
 	static void iterate(type_t&&...)
 	{
 	}
 };
+
+//
+// has_get_next
+// Whether increment_helper provides the constexpr get_next(index) counterpart of increment<index>().
+//
+template<class increment_helper, typename = void>
+struct has_get_next : std::false_type {};
+template<class increment_helper>
+struct has_get_next<increment_helper, std::void_t<decltype(increment_helper::get_next(size_t(0)))>> : std::true_type {};
+
+//
+// static_index_sequence
+// Indices visited from begin to end by an increment helper providing the constexpr get_next(index) counterpart of increment<index>(),
+// evaluated once as a constexpr array (plain offsets for increment_index_helper).
+//
+template<size_t begin, size_t end, class increment_helper>
+struct static_index_sequence
+{
+	static constexpr size_t get_count()
+	{
+		size_t count = 0;
+		for (size_t index = begin; index != end; index = increment_helper::get_next(index))
+			++count;
+		return count;
+	}
+	enum : size_t
+	{
+		count = get_count(),
+	};
+
+private:
+	static constexpr std::array<size_t, count> build()
+	{
+		std::array<size_t, count> indices{};
+		size_t index = begin;
+		for (size_t position = 0; position < count; ++position, index = increment_helper::get_next(index))
+			indices[position] = index;
+		return indices;
+	}
+	static constexpr std::array<size_t, count> indices = build();
+
+public:
+	static constexpr size_t get(size_t position)
+	{
+		return indices[position];
+	}
+};
+template<size_t begin, size_t end>
+struct static_index_sequence<begin, end, increment_index_helper>
+{
+	enum : size_t
+	{
+		count = end - begin,
+	};
+	static constexpr size_t get(size_t position)
+	{
+		return begin + position;
+	}
+};
+
+//
+// static_for_each
+// Same protocol as static_recursive_for_each, expanded over an index_sequence in a single braced initializer list (evaluated in
+// order) : the instantiation depth no longer depends on the element count. A comma fold expression would be equivalent but
+// builds a nested expression tree, which gcc handles in quadratic time. Increment helpers without get_next fall back to the recursion.
+//
+template<size_t begin, size_t end, class get_helper = get_index_helper, class increment_helper = increment_index_helper>
+struct static_for_each
+{
+private:
+	using sequence = static_index_sequence<begin, end, increment_helper>;
+
+	template<template<size_t, size_t> typename fct_type, size_t... positions, typename... type_t>
+	static void iterate_sequence(std::index_sequence<positions...>, type_t&... types)
+	{
+		using expander = int[];
+		(void)expander{ 0, (fct_type<get_helper::template get<sequence::get(positions)>(), sequence::get(positions)>(types...), 0)... };
+	}
+
+public:
+	template<template<size_t, size_t> typename fct_type, typename... type_t>
+	static void iterate(type_t&&... types)
+	{
+		if constexpr (has_get_next<increment_helper>::value)
+			iterate_sequence<fct_type>(std::make_index_sequence<sequence::count>(), types...);
+		else
+			static_recursive_for_each<begin, end, get_helper, increment_helper>::template iterate<fct_type>(types...);
+	}
+};
 } // namespace SBLib::Algorithms
 namespace SBLib { using namespace Algorithms; }
@@ -0,0 +1,78 @@
+#include <Algorithms/counter.h>
+using namespace SBLib;
+
+//
+// Compile-time benchmark of get_counter over benchmark_size calls (below the former cap of 128). Build this file alone (it
+// generates almost no code) with COUNTER_BENCHMARK_LINEAR defined to time the former lookup, probing every token from
+// COUNTER_BENCHMARK_LINEAR_CAP down to the current value, or undefined to time the bisection over max_counter_token_count.
+// Below, g++ 12 -std=c++17 -fsyntax-only, best of 5, for the whole file (0.02s without BENCHMARK_UNIT_TESTS) and per call
+// (the difference divided by benchmark_size) :
+//
+//	lookup      cap    probes per call   total time   time per call
+//	linear      128        128 - value        0.59s           5.1ms
+//	linear      500        500 - value        3.5s             31ms
+//	linear     4095       4095 - value    fails : the probe recursion exceeds the template instantiation depth (900)
+//	bisection  4095                 12        0.06s           0.37ms
+//
+// The bisection cost only grows with the logarithm of the cap, which is why it could go from 128 into the thousands.
+//
+#if defined( BENCHMARK_UNIT_TESTS )
+#define BENCHMARK_COUNTER
+#endif
+
+#if !defined( COUNTER_BENCHMARK_LINEAR_CAP )
+#define COUNTER_BENCHMARK_LINEAR_CAP 128
+#endif
+
+#if defined( BENCHMARK_COUNTER )
+namespace
+{
+	enum : size_t { benchmark_size = 112, };
+
+#if defined( COUNTER_BENCHMARK_LINEAR )
+	// declared here rather than using counter_token, so that the recursive lookup finds the overloads below by ADL
+	template<size_t counter_value> struct linear_token {};
+
+	template<size_t counter_value, bool = is_counter_reached(counter_flag<counter_value>())>
+	constexpr size_t get_linear_counter_value(int, linear_token<counter_value>)
+	{
+		return counter_value;
+	}
+	template<size_t counter_value, typename = std::enable_if_t<(counter_value > 0)>, size_t value = get_linear_counter_value(0, linear_token<counter_value - 1>())>
+	constexpr size_t get_linear_counter_value(long, linear_token<counter_value>)
+	{
+		return value;
+	}
+	constexpr size_t get_linear_counter_value(long, linear_token<0>)
+	{
+		return 0;
+	}
+	template<size_t cap = COUNTER_BENCHMARK_LINEAR_CAP, size_t current_value = get_linear_counter_value(0, linear_token<cap>()), size_t next_value = counter_constant<current_value + 1>::value>
+	constexpr size_t get_linear_counter()
+	{
+		return current_value;
+	}
+#define COUNTER_BENCHMARK_CALL get_linear_counter()
+#else
+#define COUNTER_BENCHMARK_CALL get_counter()
+#endif
+
+	// every call site needs its own expression, hence the macros
+#define COUNTER_BENCHMARK_CALLS_4  checksum += COUNTER_BENCHMARK_CALL; checksum += COUNTER_BENCHMARK_CALL; checksum += COUNTER_BENCHMARK_CALL; checksum += COUNTER_BENCHMARK_CALL;
+#define COUNTER_BENCHMARK_CALLS_16 COUNTER_BENCHMARK_CALLS_4 COUNTER_BENCHMARK_CALLS_4 COUNTER_BENCHMARK_CALLS_4 COUNTER_BENCHMARK_CALLS_4
+
+	constexpr size_t get_benchmark_checksum()
+	{
+		size_t checksum = 0;
+		COUNTER_BENCHMARK_CALLS_16 COUNTER_BENCHMARK_CALLS_16 COUNTER_BENCHMARK_CALLS_16 COUNTER_BENCHMARK_CALLS_16
+		COUNTER_BENCHMARK_CALLS_16 COUNTER_BENCHMARK_CALLS_16 COUNTER_BENCHMARK_CALLS_16
+		return checksum;
+	}
+#undef COUNTER_BENCHMARK_CALLS_16
+#undef COUNTER_BENCHMARK_CALLS_4
+#undef COUNTER_BENCHMARK_CALL
+
+	// 0 + 1 + ... + (benchmark_size - 1) : every call got its own value
+	static_assert(get_benchmark_checksum() == benchmark_size * (benchmark_size - 1) / 2, "Invalid counter values");
+}
+#endif
@@ -0,0 +1,57 @@
+#include <Algorithms/static_for_each.h>
+using namespace SBLib;
+
+//
+// Compile-time benchmark of static_for_each (index_sequence expansion) against static_recursive_for_each over benchmark_size
+// elements. Build this file alone (it generates no code) with STATIC_FOR_EACH_BENCHMARK_RECURSIVE defined to time the recursion,
+// or undefined to time the expansion. Below, g++ 12.2 -std=c++17 -fsyntax-only -ftemplate-depth=20000, best of 3, for the whole
+// file (0.04s and 29MB without BENCHMARK_UNIT_TESTS) :
+//
+//	benchmark_size   recursive time   recursive memory   expansion time   expansion memory   comma fold time
+//	           256            0.10s               39MB            0.08s               35MB             0.08s
+//	          1024            0.22s               68MB            0.16s               54MB             0.46s
+//	          4096            0.91s              191MB            0.69s              132MB              23.5s
+//
+// Without -ftemplate-depth, the recursion already fails at 1024 elements (gcc stops at a depth of 900)
+// while the expansion has no depth to speak of. The comma fold expression column is the same expansion written as a fold
+// (a single build at 4096 elements).
+//
+#if defined( BENCHMARK_UNIT_TESTS )
+#define BENCHMARK_STATIC_FOR_EACH
+#endif
+
+#if !defined( STATIC_FOR_EACH_BENCHMARK_SIZE )
+#define STATIC_FOR_EACH_BENCHMARK_SIZE 1024
+#endif
+
+#if defined( BENCHMARK_STATIC_FOR_EACH )
+namespace
+{
+	enum : size_t
+	{
+		benchmark_size = STATIC_FOR_EACH_BENCHMARK_SIZE,
+	};
+
+#if defined( STATIC_FOR_EACH_BENCHMARK_RECURSIVE )
+	template<size_t begin, size_t end> using benchmark_for_each = static_recursive_for_each<begin, end>;
+#else
+	template<size_t begin, size_t end> using benchmark_for_each = static_for_each<begin, end>;
+#endif
+
+	template<size_t value, size_t index>
+	struct accumulate_helper
+	{
+		accumulate_helper(size_t& sum)
+		{
+			sum += value * index;
+		}
+	};
+	// never called : only its instantiation is measured
+	inline size_t get_benchmark_sum()
+	{
+		size_t sum = 0;
+		benchmark_for_each<0, benchmark_size>::iterate<accumulate_helper>(sum);
+		return sum;
+	}
+}
+#endif
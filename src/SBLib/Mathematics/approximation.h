@@ -0,0 +1,175 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+
+namespace SBLib::Mathematics
+{
+//
+// eAPPROXIMATION_ACCURACY
+// Accuracy of the polynomial approximations below, as the largest absolute error on the reduced range :
+//	LOW_ACCURACY      ~5e-6   sin / cos of degree 5 / 6, atan of degree 7
+//	MEDIUM_ACCURACY   ~3e-8   sin / cos of degree 7 / 8, atan of degree 9 (float precision)
+//	HIGH_ACCURACY     ~2e-16  sin / cos of degree 13 / 14, atan of degree 21 (double precision)
+//	DEFAULT_ACCURACY  MEDIUM_ACCURACY for float, HIGH_ACCURACY for wider scalars
+//
+enum eAPPROXIMATION_ACCURACY : size_t
+{
+	LOW_ACCURACY,
+	MEDIUM_ACCURACY,
+	HIGH_ACCURACY,
+	DEFAULT_ACCURACY,
+};
+template<typename scalar_t>
+inline constexpr size_t get_approximation_accuracy(size_t accuracy)
+{
+	return (accuracy != DEFAULT_ACCURACY) ? accuracy : (sizeof(scalar_t) > sizeof(float)) ? HIGH_ACCURACY : MEDIUM_ACCURACY;
+}
+
+//
+// approximation_coefficients
+// Near-minimax coefficients (interpolation at Chebyshev nodes), lowest degree first, of
+//	sin(x) = x + x^3 P(x^2)            on [-pi/4, pi/4]
+//	cos(x) = 1 - x^2 / 2 + x^4 Q(x^2)  on [-pi/4, pi/4]
+//	atan(x) = x + x^3 R(x^2)           on [-tan(pi/8), tan(pi/8)]
+//
+template<size_t accuracy>
+struct approximation_coefficients;
+template<>
+struct approximation_coefficients<LOW_ACCURACY>
+{
+	static constexpr double sin[]  = { -0.16665731001278414, 0.008211855507308859, };
+	static constexpr double cos[]  = { 0.04166549508010972, -0.0013736814061719193, };
+	static constexpr double atan[] = { -0.3333189655778903, 0.19848097811090737, -0.11819444409601905, };
+};
+template<>
+struct approximation_coefficients<MEDIUM_ACCURACY>
+{
+	static constexpr double sin[]  = { -0.1666666466231426, 0.008332748270624041, -0.00019587890879803915, };
+	static constexpr double cos[]  = { 0.041666664659471504, -0.0013888303034340793, 2.4547941907750107e-05, };
+	static constexpr double atan[] = { -0.3333328656394364, 0.19991237743056284, -0.14024142842079437, 0.08520492036430051, };
+};
+template<>
+struct approximation_coefficients<HIGH_ACCURACY>
+{
+	static constexpr double sin[]  = { -0.16666666666667243, 0.008333333333449088, -0.0001984126992043625, 2.7557342490416666e-06, -2.505494085359579e-08, 1.612365361730322e-10, };
+	static constexpr double cos[]  = { 0.04166666666653297, -0.0013888888860082763, 2.4801566484669745e-05, -2.755066989212703e-07, 1.9906481912308422e-09, 4.142396213160386e-11, };
+	static constexpr double atan[] = { -0.3333333333333112, 0.199999999997137, -0.1428571426769197, 0.11111110105625033, -0.09090869171625773,
+	                                   0.0769134084886641, -0.06652400231199511, 0.05752048895844989, -0.04531148160527073, 0.0233581165752064, };
+};
+
+template<typename scalar_t, size_t coefficient_count>
+inline scalar_t evaluate_polynomial(const double (&coefficients)[coefficient_count], const scalar_t& x)
+{
+	scalar_t result = scalar_t(coefficients[coefficient_count - 1]);
+	for (size_t index = coefficient_count - 1; index-- > 0;)
+		result = result * x + scalar_t(coefficients[index]);
+	return result;
+}
+
+
+//
+// half_pi_split
+// Cody-Waite split of pi/2 in three constants, the first two with enough trailing zero bits for k * high and k * middle to be
+// exact : x - k pi/2 is then computed without cancellation error for |k| below 2^16 in float (|x| up to ~1e5) and 2^20 in
+// double (|x| up to ~1.6e6). Beyond, k * high gets rounded and the error grows with |x|.
+//
+template<typename scalar_t, bool is_float = (sizeof(scalar_t) <= sizeof(float))>
+struct half_pi_split
+{
+	// 8-bit high and middle parts
+	static constexpr scalar_t high   = scalar_t(1.5703125);
+	static constexpr scalar_t middle = scalar_t(4.84466552734375e-4);
+	static constexpr scalar_t low    = scalar_t(-6.397578377557687e-7);
+};
+template<typename scalar_t>
+struct half_pi_split<scalar_t, false>
+{
+	// 33-bit high and middle parts (c.f., fdlibm)
+	static constexpr scalar_t high   = scalar_t(1.57079632673412561417e+00);
+	static constexpr scalar_t middle = scalar_t(6.07710050630396597660e-11);
+	static constexpr scalar_t low    = scalar_t(2.02226624879595063154e-21);
+};
+
+//
+// approximate_sin_cos
+// x is reduced to r = x - k pi/2 in [-pi/4, pi/4] (c.f., half_pi_split), then the quadrant k mod 4 swaps and negates the
+// polynomials. Every step is a select rather than a branch, so that loops over arrays of angles vectorize.
+//
+template<size_t accuracy = DEFAULT_ACCURACY, typename scalar_t>
+inline void approximate_sin_cos(const scalar_t& x, scalar_t& sine, scalar_t& cosine)
+{
+	using coefficients = approximation_coefficients<get_approximation_accuracy<scalar_t>(accuracy)>;
+	using split = half_pi_split<scalar_t>;
+
+	const scalar_t k = std::floor(x * scalar_t(0.63661977236758134) + scalar_t(0.5));
+	const scalar_t r = ((x - k * split::high) - k * split::middle) - k * split::low;
+	const scalar_t r2 = r * r;
+	const scalar_t s = r + r * r2 * evaluate_polynomial(coefficients::sin, r2);
+	const scalar_t c = scalar_t(1) - scalar_t(0.5) * r2 + r2 * r2 * evaluate_polynomial(coefficients::cos, r2);
+
+	const int quadrant = int(k);
+	const scalar_t swapped_sine   = (quadrant & 1) ? c : s;
+	const scalar_t swapped_cosine = (quadrant & 1) ? s : c;
+	sine   = (quadrant & 2) ? -swapped_sine : swapped_sine;
+	cosine = ((quadrant + 1) & 2) ? -swapped_cosine : swapped_cosine;
+}
+template<size_t accuracy = DEFAULT_ACCURACY, typename scalar_t>
+inline scalar_t approximate_sin(const scalar_t& x)
+{
+	scalar_t sine, cosine;
+	approximate_sin_cos<accuracy>(x, sine, cosine);
+	return sine;
+}
+template<size_t accuracy = DEFAULT_ACCURACY, typename scalar_t>
+inline scalar_t approximate_cos(const scalar_t& x)
+{
+	scalar_t sine, cosine;
+	approximate_sin_cos<accuracy>(x, sine, cosine);
+	return cosine;
+}
+
+//
+// approximate_atan2
+// min(|x|, |y|) / max(|x|, |y|) is in [0, 1] and is further reduced to [-tan(pi/8), tan(pi/8)] with
+// atan(a) = pi/4 + atan((a - 1) / (a + 1)). Octant corrections are selects, and atan2(0, 0) is 0.
+//
+template<size_t accuracy = DEFAULT_ACCURACY, typename scalar_t>
+inline scalar_t approximate_atan2(const scalar_t& y, const scalar_t& x)
+{
+	using coefficients = approximation_coefficients<get_approximation_accuracy<scalar_t>(accuracy)>;
+	constexpr scalar_t quarter_pi = scalar_t(0.78539816339744831);
+	constexpr scalar_t half_pi    = scalar_t(1.5707963267948966);
+	constexpr scalar_t pi         = scalar_t(3.1415926535897932);
+
+	const scalar_t abs_x = std::abs(x), abs_y = std::abs(y);
+	const scalar_t maximum = (abs_x > abs_y) ? abs_x : abs_y;
+	const scalar_t minimum = (abs_x > abs_y) ? abs_y : abs_x;
+	const scalar_t a = minimum / ((maximum > scalar_t(0)) ? maximum : scalar_t(1));
+	const bool is_reduced = (a > scalar_t(0.41421356237309505));
+	const scalar_t z = is_reduced ? (a - scalar_t(1)) / (a + scalar_t(1)) : a;
+	const scalar_t z2 = z * z;
+	const scalar_t angle = z + z * z2 * evaluate_polynomial(coefficients::atan, z2) + (is_reduced ? quarter_pi : scalar_t(0));
+
+	const scalar_t octant_angle   = (abs_y > abs_x) ? half_pi - angle : angle;
+	const scalar_t quadrant_angle = (x < scalar_t(0)) ? pi - octant_angle : octant_angle;
+	return (y < scalar_t(0)) ? -quadrant_angle : quadrant_angle;
+}
+
+
+//
+// Batch versions over arrays (e.g., structure-of-arrays streams)
+//
+template<size_t accuracy = DEFAULT_ACCURACY, typename scalar_t>
+inline void approximate_sin_cos(const scalar_t* x, scalar_t* sine, scalar_t* cosine, size_t count)
+{
+	for (size_t index = 0; index < count; ++index)
+		approximate_sin_cos<accuracy>(x[index], sine[index], cosine[index]);
+}
+template<size_t accuracy = DEFAULT_ACCURACY, typename scalar_t>
+inline void approximate_atan2(const scalar_t* y, const scalar_t* x, scalar_t* angle, size_t count)
+{
+	for (size_t index = 0; index < count; ++index)
+		angle[index] = approximate_atan2<accuracy>(y[index], x[index]);
+}
+} // namespace SBLib::Mathematics
+namespace SBLib { using namespace Mathematics; }
@@ -1,87 +1,88 @@
 #pragma once
+#include <array>
+#include <cstddef>
+
 namespace SBLib::Mathematics
 {
 //
-// binomial_coefficient
+// binomial_coefficient_table
+// Pascal triangle of C(n, k) for 0 <= k <= n <= max_dimension, row after row, built once at compile time.
+// C(64, 32) ~ 1.8e18 is the largest entry and still fits a long long.
 //
-template<int dimension_size, int rank_size>
-struct binomial_coefficient
+struct binomial_coefficient_layout
 {
-private:
-	// binomial reflection identities
-	enum
+	enum : size_t
 	{
-		omega_0 = rank_size - dimension_size - 1,
-		omega_1 = -1 - rank_size,
-		omega_2 = -1 - dimension_size,
-		sigma_0 = +1,
-		sigma_1 = (rank_size & 1) == 0 ? +1 : -1,
-		sigma_2 = ((dimension_size - rank_size) & 1) == 0 ? +1 : -1,
-		
-		minimal_dimension = (omega_0 >= 0) ? omega_0   : omega_1,
-		minimal_rank      = (omega_0 >= 0) ? rank_size : omega_2,
-		minimal_sign      = (omega_0 >= 0) ? sigma_1   : sigma_2,
-		n    = (dimension_size >= 0) ? dimension_size : minimal_dimension,
-		k    = (dimension_size >= 0) ? rank_size : minimal_rank,
-		sign = (dimension_size >= 0) ? sigma_0   : minimal_sign,
-
-		projection = (n >= 0) && ((k < 0) || (k > n)) ? 0 : +1,
+		max_dimension = 64,
+		size          = (max_dimension + 1) * (max_dimension + 2) / 2,
 	};
 
-public:
-	// using Pascal triangle construction
-	enum : long long
-	{
-		value = projection * sign * (
-		           binomial_coefficient<n - 1, k - 1>::value
-		         + binomial_coefficient<n - 1, k    >::value
-		        )
-	};
-};
+	static constexpr size_t get_row_offset(size_t dimension_size) { return dimension_size * (dimension_size + 1) / 2; }
 
-template<>
-struct binomial_coefficient<0, 0>
-{
-	enum { value = 1 };
+	static constexpr std::array<long long, size> build()
+	{
+		std::array<long long, size> table{};
+		for (size_t n = 0; n <= max_dimension; ++n)
+		{
+			table[get_row_offset(n)] = 1;
+			table[get_row_offset(n) + n] = 1;
+			for (size_t k = 1; k < n; ++k)
+				table[get_row_offset(n) + k] = table[get_row_offset(n - 1) + k - 1] + table[get_row_offset(n - 1) + k];
+		}
+		return table;
+	}
 };
-
-template<int dimension_size>
-struct binomial_coefficient<dimension_size, 0>
+struct binomial_coefficient_table : binomial_coefficient_layout
 {
-	enum { value = 1 };
-};
+	static constexpr std::array<long long, size> values = build();
 
-template<int dimension_size>
-struct binomial_coefficient<dimension_size, dimension_size>
-{
-	enum { value = 1 };
+	// C(n, k) for 0 <= k <= n <= max_dimension, without any range check
+	static constexpr long long get(size_t dimension_size, size_t rank_size) { return values[get_row_offset(dimension_size) + rank_size]; }
 };
 
-template<>
-struct binomial_coefficient<-1, 0>
+//
+// get_binomial_coefficient
+// C(n, k) extended to negative arguments (as in Maple's binomial) by the reflection identities
+//	C(n, k) = (-1)^k C(k - n - 1, k)                 for n < 0 <= k
+//	C(n, k) = (-1)^(n - k) C(-1 - k, n - k)          for k <= n < 0
+// and 0 otherwise. Non-negative arguments read the table up to max_dimension and use the multiplicative formula beyond
+// (exact at every step, until it overflows).
+//
+inline constexpr long long get_binomial_coefficient(int dimension_size, int rank_size)
 {
-	enum { value = 1 };
-};
+	if (dimension_size < 0)
+	{
+		if (rank_size >= 0)
+			return ((rank_size & 1) == 0 ? +1 : -1) * get_binomial_coefficient(rank_size - dimension_size - 1, rank_size);
+		if (rank_size <= dimension_size)
+			return (((dimension_size - rank_size) & 1) == 0 ? +1 : -1) * get_binomial_coefficient(-1 - rank_size, dimension_size - rank_size);
+		return 0;
+	}
+	if (rank_size < 0 || rank_size > dimension_size)
+		return 0;
+	if (dimension_size <= int(binomial_coefficient_table::max_dimension))
+		return binomial_coefficient_table::values[binomial_coefficient_table::get_row_offset(size_t(dimension_size)) + size_t(rank_size)];
 
-template<>
-struct binomial_coefficient<-1, -1>
-{
-	enum { value = 1 };
-};
+	const int k = (2 * rank_size > dimension_size) ? dimension_size - rank_size : rank_size;
+	long long result = 1;
+	for (int index = 1; index <= k; ++index)
+		result = result * (dimension_size - k + index) / index;
+	return result;
+}
 
-template<int rank_size>
-struct binomial_coefficient<-1, rank_size>
+//
+// binomial_coefficient
+// Thin compile-time alias of get_binomial_coefficient : a single instantiation per (n, k) actually used.
+//
+template<int dimension_size, int rank_size>
+struct binomial_coefficient
 {
-private:
-	enum
-	{
-		rank_mod_2 = (rank_size & 1),
-	};
-public:
-	enum
+	enum : long long
 	{
-		value = (rank_size >= 0) ? 1 - 2 * rank_mod_2 : 2 * rank_mod_2 - 1,
+		value = get_binomial_coefficient(dimension_size, rank_size),
 	};
 };
+template<int dimension_size, int rank_size>
+inline constexpr long long binomial_coefficient_v = get_binomial_coefficient(dimension_size, rank_size);
 } // namespace SBLib::Mathematics
 namespace SBLib { using namespace Mathematics; }
@@ -0,0 +1,183 @@
+#pragma once
+#include <Mathematics/graded_multivector.h>
+#include <Mathematics/multivector.h>
+#include <Traits/clifford_traits.h>
+#include <type_traits>
+
+namespace SBLib::Mathematics
+{
+//
+// blade_t
+// Basis blade sign * e_(blade_mask) known at compile time and carrying no data, e.g.
+//	blade_t<(1 << 0)>                 e0
+//	blade_t<(1 << 0) | (1 << 1), -1>  -(e0^e1)
+//	pseudoscalar_t<e0 | e1 | e2>      e012
+// Products of blades are blades (sign and bit_set from alternating_traits / geometric_traits), and products of a blade with a
+// multivector_t map each result component to at most one component of the multivector with a compile-time sign : the result
+// is a permutation of the components with some negations, and zeros where the blade does not fit.
+//
+template<size_t blade_mask, int sign = +1>
+struct blade_t
+{
+	static_assert(sign >= -1 && sign <= +1, "Blade sign must be -1, 0 or +1.");
+	enum : size_t
+	{
+		blade_mask = blade_mask,
+		rank_size  = SBLib::bit_traits<blade_mask>::population_count,
+	};
+	enum : int
+	{
+		sign = sign,
+	};
+
+	template<typename scalar_t, size_t space_mask>
+	multivector_t<scalar_t, space_mask, rank_size> to_multivector() const
+	{
+		static_assert((blade_mask & ~space_mask) == 0, "Blade is not in the space.");
+		multivector_t<scalar_t, space_mask, rank_size> result;
+		result.get<blade_mask>() = scalar_t(sign);
+		return std::move(result);
+	}
+};
+template<size_t space_mask>
+using pseudoscalar_t = blade_t<space_mask>;
+
+
+//
+// Blade x blade
+//
+template<size_t blade_mask, int sign>
+inline constexpr auto operator -(blade_t<blade_mask, sign>)
+{
+	return blade_t<blade_mask, -sign>();
+}
+template<typename metric_type = SBLib::euclidian_metric, size_t blade_mask1, int sign1, size_t blade_mask2, int sign2>
+inline constexpr auto geometric_product(blade_t<blade_mask1, sign1>, blade_t<blade_mask2, sign2>)
+{
+	using traits = SBLib::geometric_traits<blade_mask1, blade_mask2, SBLib::default_basis_big_endian, metric_type>;
+	return blade_t<traits::bit_set, sign1 * sign2 * traits::sign>();
+}
+template<size_t blade_mask1, int sign1, size_t blade_mask2, int sign2>
+inline constexpr auto operator *(blade_t<blade_mask1, sign1> u, blade_t<blade_mask2, sign2> v)
+{
+	return geometric_product(u, v);
+}
+template<size_t blade_mask1, int sign1, size_t blade_mask2, int sign2>
+inline constexpr auto operator ^(blade_t<blade_mask1, sign1>, blade_t<blade_mask2, sign2>)
+{
+	using traits = SBLib::alternating_traits<blade_mask1, blade_mask2, SBLib::default_basis_big_endian>;
+	return blade_t<traits::bit_set, sign1 * sign2 * traits::sign>();
+}
+
+
+//
+// Blade x multivector
+// Each result component D reads the component D ^ blade_mask of the multivector if it has the right rank, with the sign of
+// sign_policy (c.f., graded_multivector.h) for the blade on the left (is_blade_first) or on the right.
+// Geometric products with a single result grade (e.g., the pseudoscalar I v) return a multivector_t, others a versor_t.
+//
+template<typename sign_policy, size_t blade_mask, int sign, bool is_blade_first>
+struct blade_product_helper
+{
+	template<size_t result_mask, size_t index>
+	struct do_action
+	{
+		template<typename scalar_t, size_t space_mask, size_t result_rank, size_t rank_size>
+		do_action(multivector_t<scalar_t, space_mask, result_rank>& result, const multivector_t<scalar_t, space_mask, rank_size>& v)
+		{
+			enum : size_t { source_mask = (result_mask ^ blade_mask), };
+			if constexpr (SBLib::bit_traits<source_mask>::population_count == rank_size)
+			{
+				enum : int { product_sign = sign * (is_blade_first ? sign_policy::get_sign<blade_mask, source_mask>() : sign_policy::get_sign<source_mask, blade_mask>()), };
+				if constexpr (product_sign > 0)
+					result.components[index] = v.get<source_mask>();
+				else if constexpr (product_sign < 0)
+					result.components[index] = -v.get<source_mask>();
+				else
+					result.components[index] = scalar_t(0);
+			}
+			else
+			{
+				result.components[index] = scalar_t(0);
+			}
+		}
+	};
+};
+
+template<typename scalar_t, size_t space_mask, size_t grade_mask>
+struct blade_product_result
+{
+	enum : bool { is_single_grade = (grade_mask & (grade_mask - 1)) == 0, };
+	using type = std::conditional_t<is_single_grade,
+		multivector_t<scalar_t, space_mask, SBLib::bit_traits<grade_mask - 1>::population_count>,
+		typename versor_from_grade_mask<scalar_t, space_mask, grade_mask>::type>;
+};
+
+template<typename sign_policy, size_t grade_mask, size_t blade_mask, int sign, bool is_blade_first, typename scalar_t, size_t space_mask, size_t rank_size>
+inline auto blade_product(const multivector_t<scalar_t, space_mask, rank_size>& v)
+{
+	static_assert((blade_mask & ~space_mask) == 0, "Blade is not in the space.");
+	using helper      = blade_product_helper<sign_policy, blade_mask, sign, is_blade_first>;
+	using result_type = typename blade_product_result<scalar_t, space_mask, grade_mask>::type;
+	result_type result;
+	if constexpr (blade_product_result<scalar_t, space_mask, grade_mask>::is_single_grade)
+	{
+		SBLib::for_each_combination< SBLib::select_combinations<space_mask, result_type::rank_size> >::iterate<helper::do_action>(result, v);
+	}
+	else
+	{
+		std::apply([&](auto&... parts)
+		{
+			(SBLib::for_each_combination< SBLib::select_combinations<space_mask, std::decay_t<decltype(parts)>::rank_size> >::iterate<helper::do_action>(parts, v), ...);
+		}, result);
+	}
+	return std::move(result);
+}
+
+template<typename metric_type = SBLib::euclidian_metric, size_t blade_mask, int sign, typename scalar_t, size_t space_mask, size_t rank_size>
+inline auto geometric_product(blade_t<blade_mask, sign>, const multivector_t<scalar_t, space_mask, rank_size>& v)
+{
+	enum : size_t { grade_mask = get_geometric_grade_mask((size_t(1) << blade_t<blade_mask, sign>::rank_size), (size_t(1) << rank_size), SBLib::bit_traits<space_mask>::population_count), };
+	return blade_product<geometric_sign_policy<metric_type>, grade_mask, blade_mask, sign, true>(v);
+}
+template<typename metric_type = SBLib::euclidian_metric, size_t blade_mask, int sign, typename scalar_t, size_t space_mask, size_t rank_size>
+inline auto geometric_product(const multivector_t<scalar_t, space_mask, rank_size>& v, blade_t<blade_mask, sign>)
+{
+	enum : size_t { grade_mask = get_geometric_grade_mask((size_t(1) << rank_size), (size_t(1) << blade_t<blade_mask, sign>::rank_size), SBLib::bit_traits<space_mask>::population_count), };
+	return blade_product<geometric_sign_policy<metric_type>, grade_mask, blade_mask, sign, false>(v);
+}
+template<size_t blade_mask, int sign, typename scalar_t, size_t space_mask, size_t rank_size>
+inline auto wedge_product(blade_t<blade_mask, sign>, const multivector_t<scalar_t, space_mask, rank_size>& v)
+{
+	static_assert(blade_t<blade_mask, sign>::rank_size + rank_size <= SBLib::bit_traits<space_mask>::population_count, "Wedge product rank exceeds the dimension of the space.");
+	return blade_product<exterior_sign_policy, (size_t(1) << (blade_t<blade_mask, sign>::rank_size + rank_size)), blade_mask, sign, true>(v);
+}
+template<size_t blade_mask, int sign, typename scalar_t, size_t space_mask, size_t rank_size>
+inline auto wedge_product(const multivector_t<scalar_t, space_mask, rank_size>& v, blade_t<blade_mask, sign>)
+{
+	static_assert(blade_t<blade_mask, sign>::rank_size + rank_size <= SBLib::bit_traits<space_mask>::population_count, "Wedge product rank exceeds the dimension of the space.");
+	return blade_product<exterior_sign_policy, (size_t(1) << (blade_t<blade_mask, sign>::rank_size + rank_size)), blade_mask, sign, false>(v);
+}
+
+template<size_t blade_mask, int sign, typename scalar_t, size_t space_mask, size_t rank_size>
+inline auto operator *(blade_t<blade_mask, sign> u, const multivector_t<scalar_t, space_mask, rank_size>& v)
+{
+	return geometric_product(u, v);
+}
+template<size_t blade_mask, int sign, typename scalar_t, size_t space_mask, size_t rank_size>
+inline auto operator *(const multivector_t<scalar_t, space_mask, rank_size>& u, blade_t<blade_mask, sign> v)
+{
+	return geometric_product(u, v);
+}
+template<size_t blade_mask, int sign, typename scalar_t, size_t space_mask, size_t rank_size>
+inline auto operator ^(blade_t<blade_mask, sign> u, const multivector_t<scalar_t, space_mask, rank_size>& v)
+{
+	return wedge_product(u, v);
+}
+template<size_t blade_mask, int sign, typename scalar_t, size_t space_mask, size_t rank_size>
+inline auto operator ^(const multivector_t<scalar_t, space_mask, rank_size>& u, blade_t<blade_mask, sign> v)
+{
+	return wedge_product(u, v);
+}
+} // namespace SBLib::Mathematics
+namespace SBLib { using namespace Mathematics; }
@@ -126,7 +126,7 @@ inline const auto& operator /=(canonical_components_t<scalar_t, dimension>& u, c
 	return u;
 }
 template<typename scalar_t, size_t dimension>
-inline auto operator /(const canonical_components_t<scalar_t, dimension>& v, const scalar_t& scale)
+inline auto operator /(const canonical_components_t<scalar_t, dimension>& u, const scalar_t& scale)
 {
 	const scalar_t inverse_scale = scalar_t(1) / scale;
 	using compoments_t = canonical_components_t<scalar_t, dimension>;
@@ -0,0 +1,181 @@
+#pragma once
+#include <Mathematics/exterior_algebra.h>
+#include <Mathematics/multivector.h>
+#include <Mathematics/multivector_soa.h>
+#include <Traits/clifford_traits.h>
+#include <cmath>
+
+namespace SBLib::Mathematics
+{
+//
+// Conformal geometric algebra (CGA) of 3-D Euclidian space in the null basis.
+// e0, e1 and e2 are Euclidian, cga_origin (n_o) and cga_infinity (n_inf) are null with n_o . n_inf = -1 :
+//	points                   x + x^2 / 2 n_inf + n_o
+//	dual spheres (round)     c + (c^2 - r^2) / 2 n_inf + n_o    (S . S = r^2 once normalized)
+//	dual planes (flat)       n + d n_inf                         (no n_o component at all)
+// Objects only carry the basis vectors they can have : flat objects live in the (e0, e1, e2, n_inf) subspace, so their
+// wedge products with anything skip every n_o component at compile time (e.g., a dual line plane ^ plane has 6 components
+// instead of 10), and cga_inner_product below only emits the terms that are not structurally zero.
+//
+// The null basis is not orthogonal, so general geometric products go through the diagonal basis of conformal_metric
+// (e+ = (1 << 3), e- = (1 << 4)) with n_o = (e- - e+) / 2 and n_inf = e- + e+, c.f., to_conformal_metric_basis.
+//
+enum : size_t
+{
+	cga_euclidian_mask = (1 << 0) | (1 << 1) | (1 << 2),
+	cga_origin         = (1 << 3),
+	cga_infinity       = (1 << 4),
+	cga_space_mask     = cga_euclidian_mask | cga_origin | cga_infinity,
+	cga_flat_mask      = cga_euclidian_mask | cga_infinity,
+};
+template<typename scalar_t>
+using cga_direction_t = vector_t<scalar_t, cga_euclidian_mask>;
+template<typename scalar_t>
+using cga_point_t = vector_t<scalar_t, cga_space_mask>;
+template<typename scalar_t>
+using cga_sphere_t = vector_t<scalar_t, cga_space_mask>;
+template<typename scalar_t>
+using cga_plane_t = vector_t<scalar_t, cga_flat_mask>;
+template<typename scalar_t>
+using cga_point_soa_t = vector_soa_t<scalar_t, cga_space_mask>;
+template<typename scalar_t>
+using cga_sphere_soa_t = vector_soa_t<scalar_t, cga_space_mask>;
+template<typename scalar_t>
+using cga_direction_soa_t = vector_soa_t<scalar_t, cga_euclidian_mask>;
+
+
+//
+// Inner product of vectors in the null basis : u . v = sum u_i v_i - u_o v_inf - u_inf v_o.
+// Components absent from either space mask are skipped at compile time. Both vectors must live in cga_space_mask : bits 3 and
+// 4 are the null vectors, not Euclidian ones.
+//
+struct cga_inner_product_helper
+{
+	template<size_t bit, size_t loop>
+	struct do_action
+	{
+		template<typename scalar_t, size_t space_mask1, size_t space_mask2>
+		do_action(scalar_t& result, const vector_t<scalar_t, space_mask1>& u, const vector_t<scalar_t, space_mask2>& v)
+		{
+			result += u.get<bit>() * v.get<bit>();
+		}
+	};
+};
+template<typename scalar_t, size_t space_mask1, size_t space_mask2>
+inline scalar_t cga_inner_product(const vector_t<scalar_t, space_mask1>& u, const vector_t<scalar_t, space_mask2>& v)
+{
+	static_assert(((space_mask1 | space_mask2) & ~size_t(cga_space_mask)) == 0, "cga_inner_product only applies to vectors of the CGA space (c.f., cga_space_mask).");
+	enum : size_t { euclidian_mask = (space_mask1 & space_mask2 & cga_euclidian_mask), };
+	scalar_t result = scalar_t(0);
+	SBLib::for_each_bit<euclidian_mask>::iterate<cga_inner_product_helper::do_action>(result, u, v);
+	if constexpr (((space_mask1 & cga_origin) != 0) && ((space_mask2 & cga_infinity) != 0))
+		result -= u.get<cga_origin>() * v.get<cga_infinity>();
+	if constexpr (((space_mask1 & cga_infinity) != 0) && ((space_mask2 & cga_origin) != 0))
+		result -= u.get<cga_infinity>() * v.get<cga_origin>();
+	return result;
+}
+
+
+//
+// Construction
+//
+template<typename scalar_t>
+inline cga_point_t<scalar_t> make_cga_point(const cga_direction_t<scalar_t>& x)
+{
+	cga_point_t<scalar_t> point(x);
+	point.get<cga_infinity>() = scalar_t(0.5) * cga_inner_product(x, x);
+	point.get<cga_origin>()   = scalar_t(1);
+	return std::move(point);
+}
+template<typename scalar_t>
+inline cga_sphere_t<scalar_t> make_cga_sphere(const cga_direction_t<scalar_t>& center, const scalar_t& radius)
+{
+	cga_sphere_t<scalar_t> sphere = make_cga_point(center);
+	sphere.get<cga_infinity>() -= scalar_t(0.5) * radius * radius;
+	return std::move(sphere);
+}
+// plane n . x = distance (n normalized)
+template<typename scalar_t>
+inline cga_plane_t<scalar_t> make_cga_plane(const cga_direction_t<scalar_t>& normal, const scalar_t& distance)
+{
+	cga_plane_t<scalar_t> plane(normal);
+	plane.get<cga_infinity>() = distance;
+	return std::move(plane);
+}
+
+//
+// Change of basis between the null basis (n_o, n_inf) and the diagonal basis (e+, e-) of conformal_metric.
+// Euclidian components are left untouched.
+//
+template<typename scalar_t>
+inline vector_t<scalar_t, cga_space_mask> to_conformal_metric_basis(const vector_t<scalar_t, cga_space_mask>& v)
+{
+	vector_t<scalar_t, cga_space_mask> result(v);
+	const scalar_t origin = v.get<cga_origin>(), infinity = v.get<cga_infinity>();
+	result.get<cga_origin>()   = infinity - scalar_t(0.5) * origin; // e+
+	result.get<cga_infinity>() = infinity + scalar_t(0.5) * origin; // e-
+	return std::move(result);
+}
+template<typename scalar_t>
+inline vector_t<scalar_t, cga_space_mask> from_conformal_metric_basis(const vector_t<scalar_t, cga_space_mask>& v)
+{
+	vector_t<scalar_t, cga_space_mask> result(v);
+	const scalar_t positive = v.get<cga_origin>(), negative = v.get<cga_infinity>();
+	result.get<cga_origin>()   = negative - positive;
+	result.get<cga_infinity>() = scalar_t(0.5) * (positive + negative);
+	return std::move(result);
+}
+
+
+//
+// Intersection tests
+// Two dual spheres meet iff their intersection circle S1 ^ S2 is real, that is (S1 ^ S2)^2 = (S1 . S2)^2 - S1^2 S2^2 <= 0.
+// A ray p + t d meets a dual sphere S where S . X(t) = 0, with X(t) the point at p + t d :
+//	S . X(t) = S . P + t (S . d - (p . d) s_o) - t^2 d^2 s_o / 2
+// since S . n_inf = -s_o (the weight of S). The nearest non-negative root is returned, or -1 if the ray misses.
+//
+template<typename scalar_t>
+inline bool intersects(const cga_sphere_t<scalar_t>& first, const cga_sphere_t<scalar_t>& second)
+{
+	const scalar_t cross = cga_inner_product(first, second);
+	return cross * cross <= cga_inner_product(first, first) * cga_inner_product(second, second);
+}
+
+template<typename scalar_t>
+inline scalar_t intersect(const cga_sphere_t<scalar_t>& sphere, const cga_point_t<scalar_t>& origin, const cga_direction_t<scalar_t>& direction)
+{
+	const scalar_t weight = sphere.get<cga_origin>();
+	const scalar_t a = scalar_t(-0.5) * weight * cga_inner_product(direction, direction);
+	const scalar_t b = cga_inner_product(sphere, direction) - weight * cga_inner_product(origin, direction);
+	const scalar_t c = cga_inner_product(sphere, origin);
+	const scalar_t discriminant = b * b - scalar_t(4) * a * c;
+	if (discriminant < scalar_t(0) || a == scalar_t(0))
+		return scalar_t(-1);
+	const scalar_t root = std::sqrt(discriminant);
+	const scalar_t t0 = (-b - root) / (scalar_t(2) * a);
+	const scalar_t t1 = (-b + root) / (scalar_t(2) * a);
+	const scalar_t near_t = (t0 < t1) ? t0 : t1;
+	const scalar_t far_t  = (t0 < t1) ? t1 : t0;
+	return (near_t >= scalar_t(0)) ? near_t : (far_t >= scalar_t(0)) ? far_t : scalar_t(-1);
+}
+
+
+//
+// Batch versions over structure-of-arrays streams (branch-free loop bodies apart from the final selections).
+//
+template<typename scalar_t>
+inline void intersects(bool* result, const cga_sphere_soa_t<scalar_t>& first, const cga_sphere_soa_t<scalar_t>& second)
+{
+	const size_t count = first.size();
+	for (size_t index = 0; index < count; ++index)
+		result[index] = intersects(first.load(index), second.load(index));
+}
+template<typename scalar_t>
+inline void intersect(scalar_t* result, const cga_sphere_soa_t<scalar_t>& spheres, const cga_point_soa_t<scalar_t>& origins, const cga_direction_soa_t<scalar_t>& directions)
+{
+	const size_t count = spheres.size();
+	for (size_t index = 0; index < count; ++index)
+		result[index] = intersect(spheres.load(index), origins.load(index), directions.load(index));
+}
+} // namespace SBLib::Mathematics
+namespace SBLib { using namespace Mathematics; }
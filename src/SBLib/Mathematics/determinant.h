@@ -0,0 +1,192 @@
+#pragma once
+#include <Mathematics/exterior_algebra.h>
+#include <Mathematics/multivector.h>
+#include <Mathematics/multivector_soa.h>
+#include <Traits/clifford_traits.h>
+
+namespace SBLib::Mathematics
+{
+//
+// wedge_all
+// Fused n-fold wedge product (((u ^ v0) ^ v1) ^ ...) of a k-blade u by a list of vectors.
+// Each new rank is built in gather form : every component of (u ^ v) is written exactly once as
+//	(u ^ v)[B] = sum over bits b of B of alternating_sign(B - b, b) * u[B - b] * v[b]
+// instead of accumulating every (u, v) component pair into a zero-initialized result as wedge_product does.
+// When as many vectors as the space dimension are given, the single remaining component is the determinant
+// of the vectors (c.f., determinant below), without going through any Hodge conjugation.
+//
+template<size_t rank_size>
+struct wedge_vector_helper
+{
+private:
+	template<size_t blade_mask>
+	struct gather_helper
+	{
+		template<size_t bit, size_t loop>
+		struct do_action
+		{
+			template<typename scalar_t, size_t space_mask>
+			do_action(scalar_t& result, const multivector_t<scalar_t, space_mask, rank_size>& u, const vector_t<scalar_t, space_mask>& v)
+			{
+				using traits = SBLib::alternating_traits<(blade_mask & ~bit), bit>;
+				gather_term<traits::sign, (loop == 0)>(result, u.get<(blade_mask & ~bit)>() * v.get<bit>());
+			}
+		};
+	};
+
+public:
+	template<size_t blade_mask, size_t index>
+	struct do_action
+	{
+		template<typename scalar_t, size_t space_mask>
+		do_action(multivector_t<scalar_t, space_mask, rank_size + 1>& result, const multivector_t<scalar_t, space_mask, rank_size>& u, const vector_t<scalar_t, space_mask>& v)
+		{
+			SBLib::for_each_bit<blade_mask>::iterate<gather_helper<blade_mask>::do_action>(result.components[index], u, v);
+		}
+	};
+};
+
+template<typename scalar_t, size_t space_mask, size_t rank_size>
+inline auto wedge_all(const multivector_t<scalar_t, space_mask, rank_size>& u)
+{
+	return u;
+}
+template<typename scalar_t, size_t space_mask, size_t rank_size, typename... vector_types>
+inline auto wedge_all(const multivector_t<scalar_t, space_mask, rank_size>& u, const vector_t<scalar_t, space_mask>& v, const vector_types&... vectors)
+{
+	static_assert(rank_size + 1 <= SBLib::bit_traits<space_mask>::population_count, "Too many vectors : wedge product vanishes identically.");
+	using multivec_t = multivector_t<scalar_t, space_mask, rank_size + 1>;
+	multivec_t result(multivec_t::UNINITIALIZED);
+	SBLib::for_each_combination< SBLib::select_combinations<space_mask, rank_size + 1> >::iterate<wedge_vector_helper<rank_size>::do_action>(result, u, v);
+	return wedge_all(result, vectors...);
+}
+
+
+//
+// determinant
+// Pseudoscalar coefficient of v0 ^ v1 ^ ... ^ v(n-1) in the default basis order, that is, the determinant of the n x n matrix
+// whose rows are the given vectors (columns follow space_mask bits).
+// Dimensions 1 to 4 use hand-scheduled cofactor kernels; higher dimensions unroll the gather form of wedge_all, which stays
+// branch-free straight-line code (n * 2^(n-1) multiplications, 1024 in dimension 8).
+//
+template<size_t dimension_size>
+struct determinant_kernel
+{
+	template<typename scalar_t, size_t space_mask, typename... vector_types>
+	static scalar_t evaluate(const vector_t<scalar_t, space_mask>& v0, const vector_types&... vectors)
+	{
+		return wedge_all(v0, vectors...).components[0];
+	}
+};
+template<>
+struct determinant_kernel<1>
+{
+	template<typename scalar_t, size_t space_mask>
+	static scalar_t evaluate(const vector_t<scalar_t, space_mask>& u)
+	{
+		return u.components[0];
+	}
+};
+template<>
+struct determinant_kernel<2>
+{
+	template<typename scalar_t, size_t space_mask>
+	static scalar_t evaluate(const vector_t<scalar_t, space_mask>& u, const vector_t<scalar_t, space_mask>& v)
+	{
+		return u.components[0] * v.components[1] - u.components[1] * v.components[0];
+	}
+};
+template<>
+struct determinant_kernel<3>
+{
+	template<typename scalar_t, size_t space_mask>
+	static scalar_t evaluate(const vector_t<scalar_t, space_mask>& u, const vector_t<scalar_t, space_mask>& v, const vector_t<scalar_t, space_mask>& w)
+	{
+		// u . (v x w), with the three 2x2 minors of (v ^ w) evaluated independently
+		const scalar_t m12 = v.components[1] * w.components[2] - v.components[2] * w.components[1];
+		const scalar_t m02 = v.components[0] * w.components[2] - v.components[2] * w.components[0];
+		const scalar_t m01 = v.components[0] * w.components[1] - v.components[1] * w.components[0];
+		return u.components[0] * m12 - u.components[1] * m02 + u.components[2] * m01;
+	}
+};
+template<>
+struct determinant_kernel<4>
+{
+	template<typename scalar_t, size_t space_mask>
+	static scalar_t evaluate(const vector_t<scalar_t, space_mask>& u, const vector_t<scalar_t, space_mask>& v, const vector_t<scalar_t, space_mask>& w, const vector_t<scalar_t, space_mask>& x)
+	{
+		// (u ^ v) ^ (w ^ x) : Laplace expansion over complementary 2x2 minors (two independent dependency chains)
+		const scalar_t a01 = u.components[0] * v.components[1] - u.components[1] * v.components[0];
+		const scalar_t a02 = u.components[0] * v.components[2] - u.components[2] * v.components[0];
+		const scalar_t a03 = u.components[0] * v.components[3] - u.components[3] * v.components[0];
+		const scalar_t a12 = u.components[1] * v.components[2] - u.components[2] * v.components[1];
+		const scalar_t a13 = u.components[1] * v.components[3] - u.components[3] * v.components[1];
+		const scalar_t a23 = u.components[2] * v.components[3] - u.components[3] * v.components[2];
+		const scalar_t b01 = w.components[0] * x.components[1] - w.components[1] * x.components[0];
+		const scalar_t b02 = w.components[0] * x.components[2] - w.components[2] * x.components[0];
+		const scalar_t b03 = w.components[0] * x.components[3] - w.components[3] * x.components[0];
+		const scalar_t b12 = w.components[1] * x.components[2] - w.components[2] * x.components[1];
+		const scalar_t b13 = w.components[1] * x.components[3] - w.components[3] * x.components[1];
+		const scalar_t b23 = w.components[2] * x.components[3] - w.components[3] * x.components[2];
+		return (a01 * b23 + a23 * b01) - (a02 * b13 + a13 * b02) + (a03 * b12 + a12 * b03);
+	}
+};
+
+template<typename scalar_t, size_t space_mask, typename... vector_types>
+inline scalar_t determinant(const vector_t<scalar_t, space_mask>& v0, const vector_types&... vectors)
+{
+	enum : size_t { dimension_size = SBLib::bit_traits<space_mask>::population_count, };
+	static_assert(sizeof...(vectors) + 1 == dimension_size, "Determinant requires exactly as many vectors as the space dimension.");
+	return determinant_kernel<dimension_size>::evaluate(v0, vectors...);
+}
+
+
+//
+// orientation
+// Sign of the simplex (p0, p1, ..., pn) : +1 if (p1 - p0) ^ ... ^ (pn - p0) is positively oriented w.r.t. the pseudoscalar,
+// -1 if negatively oriented and 0 if degenerate. This is a plain floating point test : close to degeneracy, round-off may
+// produce inconsistent answers.
+//
+template<typename scalar_t>
+inline constexpr int sign_of(const scalar_t& value)
+{
+	return (value > scalar_t(0)) - (value < scalar_t(0));
+}
+
+template<typename scalar_t, size_t space_mask, typename... vector_types>
+inline int orientation(const vector_t<scalar_t, space_mask>& p0, const vector_types&... points)
+{
+	return sign_of(determinant((points - p0)...));
+}
+
+
+//
+// Batch versions over structure-of-arrays streams.
+// The loop bodies are the straight-line kernels above, so consecutive elements are independent and the loops vectorize.
+//
+template<typename scalar_t, size_t space_mask, size_t rank_size, typename... vector_soa_types>
+inline void wedge_all(const multivector_soa_t<scalar_t, space_mask, rank_size>& result, const vector_soa_t<scalar_t, space_mask>& v0, const vector_soa_types&... vectors)
+{
+	static_assert(sizeof...(vectors) + 1 == rank_size, "Result rank must match the number of vectors.");
+	const size_t count = result.size();
+	for (size_t index = 0; index < count; ++index)
+		result.store(index, wedge_all(v0.load(index), vectors.load(index)...));
+}
+
+template<typename scalar_t, size_t space_mask, typename... vector_soa_types>
+inline void determinant(scalar_t* result, const vector_soa_t<scalar_t, space_mask>& v0, const vector_soa_types&... vectors)
+{
+	const size_t count = v0.size();
+	for (size_t index = 0; index < count; ++index)
+		result[index] = determinant(v0.load(index), vectors.load(index)...);
+}
+
+template<typename scalar_t, size_t space_mask, typename... vector_soa_types>
+inline void orientation(int* result, const vector_soa_t<scalar_t, space_mask>& p0, const vector_soa_types&... points)
+{
+	const size_t count = p0.size();
+	for (size_t index = 0; index < count; ++index)
+		result[index] = orientation(p0.load(index), points.load(index)...);
+}
+} // namespace SBLib::Mathematics
+namespace SBLib { using namespace Mathematics; }
@@ -0,0 +1,165 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+namespace SBLib::Mathematics
+{
+//
+// Error-free transformations (IEEE 754 double precision, round to nearest even).
+// Each one returns the rounded result x and the exact rounding error y so that a op b == x + y.
+//
+inline void two_sum(double a, double b, double& x, double& y)
+{
+	x = a + b;
+	const double b_virtual = x - a;
+	const double a_virtual = x - b_virtual;
+	y = (a - a_virtual) + (b - b_virtual);
+}
+inline void fast_two_sum(double a, double b, double& x, double& y) // requires |a| >= |b|
+{
+	x = a + b;
+	y = b - (x - a);
+}
+inline void two_diff(double a, double b, double& x, double& y)
+{
+	two_sum(a, -b, x, y);
+}
+inline void two_product(double a, double b, double& x, double& y)
+{
+	x = a * b;
+	y = std::fma(a, b, -x);
+}
+
+
+//
+// expansion_t
+// Exact real number represented as a sum of non-overlapping doubles sorted by increasing magnitude, without zero components
+// (Shewchuk's expansion arithmetic). Sums, differences and products of expansions are exact (barring overflow/underflow)
+// and the sign of an expansion is the sign of its largest component.
+// This is the slow path of the adaptive predicates : values are short-lived and only built when a floating point filter fails.
+//
+struct expansion_t
+{
+	using scalar_type = double;
+
+	expansion_t() = default;
+	expansion_t(double value)
+	{
+		if (value != 0.0)
+			components.push_back(value);
+	}
+	static expansion_t difference(double a, double b)
+	{
+		expansion_t result;
+		double x, y;
+		two_diff(a, b, x, y);
+		if (y != 0.0)
+			result.components.push_back(y);
+		if (x != 0.0)
+			result.components.push_back(x);
+		return result;
+	}
+
+	int sign() const
+	{
+		return components.empty() ? 0 : (components.back() > 0.0 ? +1 : -1);
+	}
+	double estimate() const
+	{
+		double value = 0.0;
+		for (const double component : components)
+			value += component;
+		return value;
+	}
+
+	std::vector<double> components;
+};
+
+inline expansion_t operator -(const expansion_t& e)
+{
+	expansion_t result(e);
+	for (double& component : result.components)
+		component = -component;
+	return result;
+}
+
+inline expansion_t operator +(const expansion_t& e, const expansion_t& f)
+{
+	if (e.components.empty())
+		return f;
+	if (f.components.empty())
+		return e;
+
+	// merge by increasing magnitude, then sweep with two_sum (linear expansion sum with zero elimination)
+	std::vector<double> merged(e.components.size() + f.components.size());
+	std::merge(e.components.begin(), e.components.end(), f.components.begin(), f.components.end(), merged.begin(),
+		[](double a, double b) { return std::abs(a) < std::abs(b); });
+
+	expansion_t result;
+	result.components.reserve(merged.size());
+	double q = merged[0];
+	for (size_t index = 1; index < merged.size(); ++index)
+	{
+		double q_new, h;
+		two_sum(q, merged[index], q_new, h);
+		if (h != 0.0)
+			result.components.push_back(h);
+		q = q_new;
+	}
+	if (q != 0.0)
+		result.components.push_back(q);
+	return result;
+}
+inline expansion_t operator -(const expansion_t& e, const expansion_t& f)
+{
+	return e + (-f);
+}
+
+inline expansion_t operator *(const expansion_t& e, double b)
+{
+	expansion_t result;
+	if (e.components.empty() || b == 0.0)
+		return result;
+
+	// scale expansion with zero elimination
+	result.components.reserve(2 * e.components.size());
+	double q, h;
+	two_product(e.components[0], b, q, h);
+	if (h != 0.0)
+		result.components.push_back(h);
+	for (size_t index = 1; index < e.components.size(); ++index)
+	{
+		double product1, product0, sum;
+		two_product(e.components[index], b, product1, product0);
+		two_sum(q, product0, sum, h);
+		if (h != 0.0)
+			result.components.push_back(h);
+		fast_two_sum(product1, sum, q, h);
+		if (h != 0.0)
+			result.components.push_back(h);
+	}
+	if (q != 0.0)
+		result.components.push_back(q);
+	return result;
+}
+inline expansion_t operator *(const expansion_t& e, const expansion_t& f)
+{
+	const expansion_t& shortest = (e.components.size() < f.components.size()) ? e : f;
+	const expansion_t& longest  = (e.components.size() < f.components.size()) ? f : e;
+	expansion_t result;
+	for (const double component : shortest.components)
+		result = result + longest * component;
+	return result;
+}
+
+inline expansion_t& operator +=(expansion_t& e, const expansion_t& f)
+{
+	return e = e + f;
+}
+inline expansion_t& operator -=(expansion_t& e, const expansion_t& f)
+{
+	return e = e - f;
+}
+} // namespace SBLib::Mathematics
+namespace SBLib { using namespace Mathematics; }
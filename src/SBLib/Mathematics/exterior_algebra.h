@@ -0,0 +1,244 @@
+#pragma once
+#include <Mathematics/multivector.h>
+#include <Mathematics/multivector_soa.h>
+#include <Traits/clifford_traits.h>
+
+namespace SBLib::Mathematics
+{
+//
+// gather_term
+// Signed accumulation of one product term into a component computed in gather form (every result component written once) :
+// the first term of the sum is assigned, the following ones are accumulated. Unlike accumulating into a zero-initialized
+// result, this does not rely on the compiler folding 0 + x, which it may not do on floating point types.
+//
+template<int sign, bool is_first, typename scalar_t>
+inline constexpr void gather_term(scalar_t& result, const scalar_t& term)
+{
+	if constexpr (is_first)
+		result = (sign > 0) ? term : -term;
+	else if constexpr (sign > 0)
+		result += term;
+	else
+		result -= term;
+}
+
+
+//
+// Wedge product
+//
+template<size_t subspace_mask, size_t loop>
+struct wedge_product_helper
+{
+private:
+	template<size_t subspace_mask2, size_t loop2>
+	struct wedge_product_internal
+	{
+		template<typename scalar_t>
+		struct assign
+		{
+			template<int sign> static constexpr void alternate_multiply(scalar_t, const scalar_t&, const scalar_t&) {}; // nothing to do
+		};
+		template<typename scalar_t>
+		struct assign<scalar_t&>
+		{
+			template<int sign> static constexpr void alternate_multiply    (scalar_t& result, const scalar_t& u, const scalar_t& v); // should not be called
+			template<>         static constexpr void alternate_multiply<+1>(scalar_t& result, const scalar_t& u, const scalar_t& v) { result += u * v; }
+			template<>         static constexpr void alternate_multiply<-1>(scalar_t& result, const scalar_t& u, const scalar_t& v) { result -= u * v; }
+		};
+
+	public:
+		template<typename scalar_t, size_t space_mask0, size_t space_mask2, size_t rank_size0, size_t rank_size2>
+		wedge_product_internal(multivector_t<scalar_t, space_mask0, rank_size0>& result, const scalar_t& u, const multivector_t<scalar_t, space_mask2, rank_size2>& v)
+		{
+			using traits = SBLib::alternating_traits<subspace_mask, subspace_mask2>;
+			using ref_type = decltype( result.get<(subspace_mask ^ subspace_mask2)>() );
+			assign<ref_type>::alternate_multiply<traits::sign>(result.get<(subspace_mask ^ subspace_mask2)>(), u, v.get<subspace_mask2>());
+		}
+	};
+
+public:
+	template<typename scalar_t, size_t space_mask0, size_t space_mask1, size_t space_mask2, size_t rank_size0, size_t rank_size1, size_t rank_size2>
+	wedge_product_helper(multivector_t<scalar_t, space_mask0, rank_size0>& result, const multivector_t<scalar_t, space_mask1, rank_size1>& u, const multivector_t<scalar_t, space_mask2, rank_size2>& v)
+	{
+		SBLib::for_each_combination< SBLib::select_combinations<space_mask2, rank_size2> >::iterate<wedge_product_internal>(result, u.get<subspace_mask>(), v);
+	}
+};
+//
+// Generic version
+// The result types of the generic versions are spelled out rather than deduced, so that extern template declarations
+// (c.f., prebuilt_algebra.h) spare their instantiation in dependent translation units.
+//
+template<typename scalar_t, size_t space_mask1, size_t space_mask2, size_t rank_size1, size_t rank_size2>
+multivector_t<scalar_t, (space_mask1 | space_mask2), (rank_size1 + rank_size2)> wedge_product(const multivector_t<scalar_t, space_mask1, rank_size1>& u, const multivector_t<scalar_t, space_mask2, rank_size2>& v)
+{
+	using multivec_t = multivector_t<scalar_t, (space_mask1 | space_mask2), (rank_size1 + rank_size2)>;
+	multivec_t result;
+	SBLib::for_each_combination< SBLib::select_combinations<space_mask1, rank_size1> >::iterate<wedge_product_helper>(result, u, v);
+	return std::move(result);
+}
+
+template<typename scalar_t, size_t space_mask1, size_t space_mask2, size_t rank_size1, size_t rank_size2>
+auto operator ^(const multivector_t<scalar_t, space_mask1, rank_size1>& u, const multivector_t<scalar_t, space_mask2, rank_size2>& v)
+{
+	return std::move(wedge_product(u, v));
+}
+
+
+//
+// Hodge dual
+// With a non-Euclidian metric, *B is scaled by the square of B (c.f., hodge_conjugacy_traits), so components dual to
+// blades containing a null vector are zero.
+//
+template<typename metric_type>
+struct hodge_conjugate_helper
+{
+private:
+	template<typename scalar_t>
+	struct assign
+	{
+		template<int sign> static constexpr void conjugate(scalar_t, const scalar_t&) {}; // result is not in destination space : nothing to do
+	};
+	template<typename scalar_t>
+	struct assign<scalar_t&>
+	{
+		template<int sign> static constexpr void conjugate(scalar_t& result, const scalar_t& u); // should not be called ever
+		template<>         static constexpr void conjugate<+1>(scalar_t& result, const scalar_t& u) { result = +u; }
+		template<>         static constexpr void conjugate<-1>(scalar_t& result, const scalar_t& u) { result = -u; }
+		template<>         static constexpr void conjugate< 0>(scalar_t& result, const scalar_t&)   { result = scalar_t(0); }
+	};
+
+public:
+	template<size_t subspace_mask, size_t loop>
+	struct do_action
+	{
+		template<typename scalar_t, size_t space_mask0, size_t space_mask1, size_t rank_size0, size_t rank_size1>
+		do_action(multivector_t<scalar_t, space_mask0, rank_size0>& result, const multivector_t<scalar_t, space_mask1, rank_size1>& u)
+		{
+			using traits = SBLib::hodge_conjugacy_traits<subspace_mask, space_mask0, SBLib::default_basis_big_endian, metric_type>;
+			using ref_type = decltype(result.get<traits::bit_set>());
+			static_assert((subspace_mask & space_mask0) == subspace_mask, "Cannot calculate Hodge dual over non-embedding space. Please project onto target space first.");
+			static_assert((subspace_mask ^ traits::bit_set) == space_mask0, "Incorrect dual space.");
+			assign<ref_type>::conjugate<traits::sign>(result.get<traits::bit_set>(), u.get<subspace_mask>());
+		}
+	};
+};
+//
+// Generic version
+//
+template<typename metric_type = SBLib::euclidian_metric, typename scalar_t, size_t space_mask, size_t rank_size>
+multivector_t<scalar_t, space_mask, SBLib::bit_traits<space_mask>::population_count - rank_size> hodge_conjugate(const multivector_t<scalar_t, space_mask, rank_size>& u)
+{
+	using multivec_t = multivector_t<scalar_t, space_mask, vector_t<scalar_t, space_mask>::dimension_size - rank_size>;
+	multivec_t result(multivec_t::UNINITIALIZED);
+	SBLib::for_each_combination< SBLib::select_combinations<space_mask, rank_size> >::iterate<hodge_conjugate_helper<metric_type>::do_action>(result, u);
+	return std::move(result);
+}
+template<typename scalar_t, size_t space_mask, size_t rank_size>
+auto operator *(const multivector_t<scalar_t, space_mask, rank_size>& u)
+{
+	return std::move(hodge_conjugate(u));
+}
+
+
+//
+// Regressive product (meet)
+// Computes *(*u ^ *v) directly : with *A = s(A) e(~A), the only blade pairs (A, B) contributing are those spanning the whole
+// space (A | B == space_mask), and each one contributes to the single blade A & B with the compile-time sign
+//	s(A) * s(B) * alternating_sign(~A, ~B) * s(~A | ~B)
+// Each result component K is gathered over the splits A = K | X, B = space_mask & ~X, X running over the rank(u) - rank(K)
+// combinations of the complement of K, so no dual temporaries are built and nothing is accumulated into zeros.
+//
+template<size_t space_mask, size_t rank_size1, size_t rank_size2>
+struct regressive_product_helper
+{
+private:
+	enum : size_t
+	{
+		dimension_size = SBLib::bit_traits<space_mask>::population_count,
+		meet_rank_size = rank_size1 + rank_size2 - dimension_size,
+	};
+	template<size_t meet_mask>
+	struct gather_helper
+	{
+		template<size_t split_mask, size_t loop>
+		struct do_action
+		{
+			template<typename scalar_t>
+			do_action(scalar_t& result, const multivector_t<scalar_t, space_mask, rank_size1>& u, const multivector_t<scalar_t, space_mask, rank_size2>& v)
+			{
+				enum : size_t
+				{
+					first_mask       = (meet_mask | split_mask),
+					second_mask      = (space_mask & ~split_mask),
+					first_dual_mask  = SBLib::hodge_conjugacy_traits<first_mask, space_mask>::bit_set,
+					second_dual_mask = SBLib::hodge_conjugacy_traits<second_mask, space_mask>::bit_set,
+					join_dual_mask   = (first_dual_mask | second_dual_mask),
+				};
+				static_assert(SBLib::hodge_conjugacy_traits<join_dual_mask, space_mask>::bit_set == meet_mask, "Incorrect meet.");
+				enum : int
+				{
+					sign = SBLib::hodge_conjugacy_traits<first_mask, space_mask>::sign
+					     * SBLib::hodge_conjugacy_traits<second_mask, space_mask>::sign
+					     * SBLib::alternating_traits<first_dual_mask, second_dual_mask>::sign
+					     * SBLib::hodge_conjugacy_traits<join_dual_mask, space_mask>::sign,
+				};
+				gather_term<sign, (loop == 0)>(result, u.get<first_mask>() * v.get<second_mask>());
+			}
+		};
+	};
+
+public:
+	template<size_t meet_mask, size_t index>
+	struct do_action
+	{
+		template<typename scalar_t>
+		do_action(multivector_t<scalar_t, space_mask, meet_rank_size>& result, const multivector_t<scalar_t, space_mask, rank_size1>& u, const multivector_t<scalar_t, space_mask, rank_size2>& v)
+		{
+			using split_traits = SBLib::select_combinations<(space_mask & ~meet_mask), rank_size1 - meet_rank_size>;
+			SBLib::for_each_combination<split_traits>::iterate<gather_helper<meet_mask>::do_action>(result.components[index], u, v);
+		}
+	};
+};
+//
+// Generic version
+//
+template<typename scalar_t, size_t space_mask, size_t rank_size1, size_t rank_size2>
+multivector_t<scalar_t, space_mask, rank_size1 + rank_size2 - SBLib::bit_traits<space_mask>::population_count> regressive_product(const multivector_t<scalar_t, space_mask, rank_size1>& u, const multivector_t<scalar_t, space_mask, rank_size2>& v)
+{
+	enum : size_t { dimension_size = SBLib::bit_traits<space_mask>::population_count, };
+	static_assert(rank_size1 + rank_size2 >= dimension_size, "Regressive product vanishes : subspaces do not span the whole space.");
+	using multivec_t = multivector_t<scalar_t, space_mask, rank_size1 + rank_size2 - dimension_size>;
+	multivec_t result(multivec_t::UNINITIALIZED);
+	SBLib::for_each_combination< SBLib::select_combinations<space_mask, multivec_t::rank_size> >::iterate<regressive_product_helper<space_mask, rank_size1, rank_size2>::do_action>(result, u, v);
+	return std::move(result);
+}
+template<typename scalar_t, size_t space_mask, size_t rank_size1, size_t rank_size2>
+auto operator &(const multivector_t<scalar_t, space_mask, rank_size1>& u, const multivector_t<scalar_t, space_mask, rank_size2>& v)
+{
+	return std::move(regressive_product(u, v));
+}
+//
+// Batch version : meets of many pairs of primitives stored as structure-of-arrays streams.
+//
+template<typename scalar_t, size_t space_mask, size_t rank_size0, size_t rank_size1, size_t rank_size2>
+void regressive_product(const multivector_soa_t<scalar_t, space_mask, rank_size0>& result, const multivector_soa_t<scalar_t, space_mask, rank_size1>& u, const multivector_soa_t<scalar_t, space_mask, rank_size2>& v)
+{
+	static_assert(rank_size0 + SBLib::bit_traits<space_mask>::population_count == rank_size1 + rank_size2, "Incorrect result rank.");
+	const size_t count = result.size();
+	for (size_t index = 0; index < count; ++index)
+		result.store(index, regressive_product(u.load(index), v.load(index)));
+}
+
+
+template<typename scalar_t, size_t space_mask1, size_t space_mask2, size_t rank_size1, size_t rank_size2>
+auto CrossProduct(const multivector_t<scalar_t, space_mask1, rank_size1>& u, const multivector_t<scalar_t, space_mask2, rank_size2>& v)
+{
+	return std::move( *(u ^ v) );
+}
+template<typename scalar_t, size_t space_mask1, size_t space_mask2, size_t rank_size1, size_t rank_size2>
+auto InnerProduct(const multivector_t<scalar_t, space_mask1, rank_size1>& u, const multivector_t<scalar_t, space_mask2, rank_size2>& v)
+{
+	return std::move( *(u ^ *v) );
+}
+} // namespace SBLib::Mathematics
+namespace SBLib { using namespace Mathematics; }
@@ -0,0 +1,212 @@
+#pragma once
+#include <Mathematics/multivector.h>
+#include <Mathematics/multivector_soa.h>
+#include <Traits/clifford_traits.h>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace SBLib::Mathematics
+{
+//
+// versor_t
+// A versor (rotor, reflector, motor, ...) or any mixed-grade multivector carried as the tuple of its separate grade parts, e.g.
+//	versor_t<float, e0 | e1 | e2, 0, 2>
+// is a 3-D rotor made of its scalar and bivector parts.
+//
+template<typename scalar_t, size_t space_mask, size_t... versor_ranks>
+using versor_t = std::tuple<multivector_t<scalar_t, space_mask, versor_ranks>...>;
+
+template<typename scalar_t, size_t space_mask, size_t... versor_ranks>
+using versor_soa_t = std::tuple<multivector_soa_t<scalar_t, space_mask, versor_ranks>...>;
+
+template<size_t rank_size, size_t... versor_ranks>
+struct versor_part_traits
+{
+private:
+	static constexpr size_t get_part_index()
+	{
+		constexpr size_t ranks[] = { versor_ranks... };
+		for (size_t index = 0; index < sizeof...(versor_ranks); ++index)
+			if (ranks[index] == rank_size)
+				return index;
+		return sizeof...(versor_ranks);
+	}
+public:
+	enum : size_t
+	{
+		part_index = get_part_index(),
+		has_part   = (part_index < sizeof...(versor_ranks)),
+	};
+};
+
+template<size_t blade_mask, typename scalar_t, size_t space_mask, size_t... versor_ranks>
+inline constexpr scalar_t get_versor_component(const versor_t<scalar_t, space_mask, versor_ranks...>& versor)
+{
+	using traits = versor_part_traits<SBLib::bit_traits<blade_mask>::population_count, versor_ranks...>;
+	return std::get<traits::part_index>(versor).get<blade_mask>();
+}
+
+//
+// reverse
+// Reversion R -> R~ of every grade part : (-1)^(k (k - 1) / 2) on grade k.
+//
+template<typename scalar_t, size_t space_mask, size_t... versor_ranks>
+inline auto reverse(const versor_t<scalar_t, space_mask, versor_ranks...>& versor)
+{
+	versor_t<scalar_t, space_mask, versor_ranks...> result(versor);
+	((SBLib::reversion_conjugacy_traits<((size_t(1) << versor_ranks) - 1)>::sign < 0 ? void(std::get<multivector_t<scalar_t, space_mask, versor_ranks>>(result) *= scalar_t(-1)) : void()), ...);
+	return std::move(result);
+}
+
+//
+// versor_from_grade_mask
+// versor_t type holding the grades selected by the bits of grade_mask (bit g set for grade g).
+//
+template<typename scalar_t, size_t space_mask, size_t grade_mask, size_t... versor_ranks>
+struct versor_from_grade_mask
+{
+private:
+	enum : size_t
+	{
+		first_grade_bit = SBLib::bit_traits<grade_mask>::get_bit<0>(),
+		first_grade     = SBLib::bit_traits<first_grade_bit - 1>::population_count,
+	};
+public:
+	using type = typename versor_from_grade_mask<scalar_t, space_mask, (grade_mask & ~first_grade_bit), versor_ranks..., first_grade>::type;
+};
+template<typename scalar_t, size_t space_mask, size_t... versor_ranks>
+struct versor_from_grade_mask<scalar_t, space_mask, 0, versor_ranks...>
+{
+	using type = versor_t<scalar_t, space_mask, versor_ranks...>;
+};
+
+
+//
+// get_geometric_grade_mask
+// Grades (bit g set for grade g) of the geometric product of operands holding the grades of grade_mask1 and grade_mask2 in
+// an n-D space : every pair of operand grades r1, r2 reaches |r1 - r2|, |r1 - r2| + 2, ..., min(r1 + r2, 2 n - r1 - r2), as
+// blades A and B share at least r1 + r2 - n vectors, which cancel out in pairs.
+//
+inline constexpr size_t get_geometric_grade_mask(size_t grade_mask1, size_t grade_mask2, size_t dimension_size)
+{
+	size_t grade_mask = 0;
+	for (size_t first_rank = 0; first_rank <= dimension_size; ++first_rank)
+		for (size_t second_rank = 0; second_rank <= dimension_size; ++second_rank)
+		{
+			if ((grade_mask1 & (size_t(1) << first_rank)) == 0 || (grade_mask2 & (size_t(1) << second_rank)) == 0)
+				continue;
+			const size_t sum_rank  = first_rank + second_rank;
+			const size_t low_rank  = (first_rank > second_rank) ? (first_rank - second_rank) : (second_rank - first_rank);
+			const size_t high_rank = (sum_rank < 2 * dimension_size - sum_rank) ? sum_rank : (2 * dimension_size - sum_rank);
+			for (size_t rank = low_rank; rank <= high_rank; rank += 2)
+				grade_mask |= (size_t(1) << rank);
+		}
+	return grade_mask;
+}
+
+//
+// Geometric product
+// Product of two mixed-grade multivectors for a given metric. Grades of the result are those of get_geometric_grade_mask,
+// and each result component D sums the terms u[A] v[B] over the blades A of u for which B = A ^ D is a blade of v, with the
+// compile-time sign geometric_traits<A, B, metric>::sign.
+// Metric signs are folded in the signs and terms contracting null vectors (sign 0) are dropped at compile time, so
+// non-Euclidian products cost no more than Euclidian ones.
+//
+template<typename metric_type, size_t... ranks1>
+struct geometric_product_helper
+{
+	template<size_t... ranks2>
+	static constexpr size_t get_grade_mask(size_t dimension_size)
+	{
+		return get_geometric_grade_mask(((size_t(1) << ranks1) | ...), ((size_t(1) << ranks2) | ...), dimension_size);
+	}
+
+	template<size_t result_mask, size_t... ranks2>
+	struct term_helper
+	{
+		template<size_t first_mask, size_t loop>
+		struct do_action
+		{
+			template<typename scalar_t, size_t space_mask>
+			do_action(scalar_t& result, const versor_t<scalar_t, space_mask, ranks1...>& u, const versor_t<scalar_t, space_mask, ranks2...>& v)
+			{
+				enum : size_t
+				{
+					second_mask = (first_mask ^ result_mask),
+					second_rank = SBLib::bit_traits<second_mask>::population_count,
+				};
+				if constexpr (versor_part_traits<second_rank, ranks2...>::has_part)
+				{
+					enum : int { sign = SBLib::geometric_traits<first_mask, second_mask, SBLib::default_basis_big_endian, metric_type>::sign, };
+					if constexpr (sign > 0)
+						result += get_versor_component<first_mask>(u) * get_versor_component<second_mask>(v);
+					else if constexpr (sign < 0)
+						result -= get_versor_component<first_mask>(u) * get_versor_component<second_mask>(v);
+				}
+			}
+		};
+	};
+
+	template<size_t... ranks2>
+	struct component_helper
+	{
+		template<size_t result_mask, size_t index>
+		struct do_action
+		{
+			template<typename scalar_t, size_t space_mask, size_t result_rank>
+			do_action(multivector_t<scalar_t, space_mask, result_rank>& result, const versor_t<scalar_t, space_mask, ranks1...>& u, const versor_t<scalar_t, space_mask, ranks2...>& v)
+			{
+				scalar_t& value = result.components[index];
+				value = scalar_t(0);
+				(SBLib::for_each_combination< SBLib::select_combinations<space_mask, ranks1> >::iterate<term_helper<result_mask, ranks2...>::do_action>(value, u, v), ...);
+			}
+		};
+	};
+};
+
+template<typename metric_type = SBLib::euclidian_metric, typename scalar_t, size_t space_mask, size_t... ranks1, size_t... ranks2>
+auto geometric_product(const versor_t<scalar_t, space_mask, ranks1...>& u, const versor_t<scalar_t, space_mask, ranks2...>& v)
+{
+	using helper = geometric_product_helper<metric_type, ranks1...>;
+	enum : size_t { grade_mask = helper::get_grade_mask<ranks2...>(SBLib::bit_traits<space_mask>::population_count), };
+	using result_type = typename versor_from_grade_mask<scalar_t, space_mask, grade_mask>::type;
+	result_type result;
+	std::apply([&](auto&... parts)
+	{
+		(SBLib::for_each_combination< SBLib::select_combinations<space_mask, std::decay_t<decltype(parts)>::rank_size> >::iterate<helper::component_helper<ranks2...>::do_action>(parts, u, v), ...);
+	}, result);
+	return std::move(result);
+}
+//
+// Single-grade version
+// The result type is spelled out rather than deduced, so that extern template declarations (c.f., prebuilt_algebra.h) spare
+// its instantiation in dependent translation units.
+//
+template<typename metric_type, typename scalar_t, size_t space_mask, size_t rank_size1, size_t rank_size2>
+using geometric_product_t = typename versor_from_grade_mask<scalar_t, space_mask, geometric_product_helper<metric_type, rank_size1>::get_grade_mask<rank_size2>(SBLib::bit_traits<space_mask>::population_count)>::type;
+
+template<typename metric_type = SBLib::euclidian_metric, typename scalar_t, size_t space_mask, size_t rank_size1, size_t rank_size2>
+geometric_product_t<metric_type, scalar_t, space_mask, rank_size1, rank_size2> geometric_product(const multivector_t<scalar_t, space_mask, rank_size1>& u, const multivector_t<scalar_t, space_mask, rank_size2>& v)
+{
+	return geometric_product<metric_type>(versor_t<scalar_t, space_mask, rank_size1>(u), versor_t<scalar_t, space_mask, rank_size2>(v));
+}
+//
+// Batch version over structure-of-arrays streams.
+//
+template<typename metric_type = SBLib::euclidian_metric, typename scalar_t, size_t space_mask, size_t... ranks0, size_t... ranks1, size_t... ranks2>
+void geometric_product(const versor_soa_t<scalar_t, space_mask, ranks0...>& result, const versor_soa_t<scalar_t, space_mask, ranks1...>& u, const versor_soa_t<scalar_t, space_mask, ranks2...>& v)
+{
+	using product_type = decltype(geometric_product<metric_type>(std::declval<versor_t<scalar_t, space_mask, ranks1...>>(), std::declval<versor_t<scalar_t, space_mask, ranks2...>>()));
+	static_assert(std::is_same_v<product_type, versor_t<scalar_t, space_mask, ranks0...>>, "Result grades must match the grades of the product.");
+	const size_t count = std::get<0>(u).size();
+	for (size_t index = 0; index < count; ++index)
+	{
+		const versor_t<scalar_t, space_mask, ranks0...> value = geometric_product<metric_type>(
+			versor_t<scalar_t, space_mask, ranks1...>(std::get<multivector_soa_t<scalar_t, space_mask, ranks1>>(u).load(index)...),
+			versor_t<scalar_t, space_mask, ranks2...>(std::get<multivector_soa_t<scalar_t, space_mask, ranks2>>(v).load(index)...));
+		(std::get<multivector_soa_t<scalar_t, space_mask, ranks0>>(result).store(index, std::get<multivector_t<scalar_t, space_mask, ranks0>>(value)), ...);
+	}
+}
+} // namespace SBLib::Mathematics
+namespace SBLib { using namespace Mathematics; }
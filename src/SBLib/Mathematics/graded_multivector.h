@@ -0,0 +1,400 @@
+#pragma once
+#include <Mathematics/geometric_product.h>
+#include <Mathematics/multivector.h>
+#include <Traits/clifford_traits.h>
+#include <tuple>
+#include <type_traits>
+
+namespace SBLib::Mathematics
+{
+//
+// graded_traits
+// Layout of the grades selected by grade_mask (bit g set for grade g) : grade after grade, in increasing order, each grade in
+// multivector_t (combinations) order. The component of a blade is the offset of its grade plus its combinations index.
+// With grade_mask = (1 | 4 | 16 | ...), the layout is the one of spinor_t.
+//
+template<size_t space_mask, size_t grade_mask>
+struct graded_traits
+{
+	static constexpr size_t get_grade_offset(size_t rank_size)
+	{
+		constexpr size_t dimension = SBLib::bit_traits<space_mask>::population_count;
+		size_t offset = 0;
+		for (size_t rank = 0; rank < rank_size && rank <= dimension; ++rank)
+		{
+			if ((grade_mask & (size_t(1) << rank)) == 0)
+				continue;
+			offset += size_t(binomial_coefficient_table::get(dimension, rank));
+		}
+		return offset;
+	}
+	enum : size_t
+	{
+		space_dimension = SBLib::bit_traits<space_mask>::population_count,
+		dimension_size  = get_grade_offset(space_dimension + 1),
+	};
+	static_assert(space_dimension < 8 * sizeof(size_t), "Grade masks hold one bit per grade, up to 63-D spaces.");
+	static_assert((grade_mask >> space_dimension) <= 1, "Grades cannot exceed the dimension of the space.");
+
+	template<size_t blade_mask>
+	struct has_blade
+	{
+		enum : bool { value = ((blade_mask & ~space_mask) == 0) && ((grade_mask & (size_t(1) << SBLib::bit_traits<blade_mask>::population_count)) != 0), };
+	};
+	template<size_t blade_mask>
+	constexpr static size_t get_components_index()
+	{
+		enum : size_t { rank_size = SBLib::bit_traits<blade_mask>::population_count, };
+		return get_grade_offset(rank_size) + select_combinations<space_mask, rank_size>::get_components_index<blade_mask>();
+	}
+};
+
+//
+// for_each_graded_blade
+// for_each_combination over every grade of grade_mask : fct_type<blade_mask, index> is called with the index of the blade
+// within its grade.
+//
+template<size_t space_mask, template<size_t, size_t> typename fct_type>
+struct for_each_graded_blade_helper
+{
+	template<size_t grade_bit, size_t loop>
+	struct do_action
+	{
+		template<typename... type_t>
+		do_action(type_t&&... types)
+		{
+			SBLib::for_each_combination< SBLib::select_combinations<space_mask, SBLib::bit_traits<grade_bit - 1>::population_count> >::iterate<fct_type>(types...);
+		}
+	};
+};
+template<size_t space_mask, size_t grade_mask>
+struct for_each_graded_blade
+{
+	template<template<size_t, size_t> typename fct_type, typename... type_t>
+	static void iterate(type_t&&... types)
+	{
+		SBLib::for_each_bit<grade_mask>::iterate<for_each_graded_blade_helper<space_mask, fct_type>::do_action>(types...);
+	}
+};
+
+
+//
+// graded_multivector_t
+// Multivector holding only the grades of grade_mask, stored contiguously, e.g.
+//	graded_multivector_t<float, e0 | e1 | e2, (1 << 0) | (1 << 2)>
+// is a 3-D rotor in 4 consecutive floats rather than the versor_t tuple of a scalar and a bivector.
+// Grades outside of grade_mask are never stored : reading them gives 0 and every operation below computes the grade set
+// of its result at compile time, so structurally zero grades are neither stored nor computed.
+//
+template<typename scalar_t, size_t space_mask, size_t grade_mask>
+struct graded_multivector_t
+{
+private:
+	using traits = graded_traits<space_mask, grade_mask>;
+
+	template<size_t rank_size>
+	void load_part(const multivector_t<scalar_t, space_mask, rank_size>& part)
+	{
+		enum : size_t { offset = traits::get_grade_offset(rank_size), };
+		for (size_t index = 0; index < multivector_t<scalar_t, space_mask, rank_size>::dimension_size; ++index)
+			components[offset + index] = part.components[index];
+	}
+	template<size_t rank_size>
+	void store_part(multivector_t<scalar_t, space_mask, rank_size>& part) const
+	{
+		enum : size_t { offset = traits::get_grade_offset(rank_size), };
+		for (size_t index = 0; index < multivector_t<scalar_t, space_mask, rank_size>::dimension_size; ++index)
+			part.components[index] = components[offset + index];
+	}
+
+	template<size_t blade_mask, size_t loop>
+	struct component_assign_helper
+	{
+		template<size_t alt_grade_mask>
+		component_assign_helper(graded_multivector_t& u, const graded_multivector_t<scalar_t, space_mask, alt_grade_mask>& v)
+		{
+			u.get<blade_mask>() = v.get<blade_mask>();
+		}
+	};
+
+public:
+	enum : size_t
+	{
+		space_mask     = space_mask,
+		grade_mask     = grade_mask,
+		dimension_size = traits::dimension_size,
+	};
+	using components_type = canonical_components_t<scalar_t, dimension_size>;
+	using scalar_type     = typename components_type::scalar_type;
+	using versor_type     = typename versor_from_grade_mask<scalar_t, space_mask, grade_mask>::type;
+
+	enum eUNINITIALIZED : bool { UNINITIALIZED = true, };
+	graded_multivector_t(eUNINITIALIZED) : components(components_type::UNINITIALIZED) {};
+
+	graded_multivector_t() : components() {};
+	graded_multivector_t(const graded_multivector_t& v) : components(v.components) {};
+	explicit graded_multivector_t(const components_type& v) : components(v) {};
+	explicit graded_multivector_t(components_type&& v) : components(v) {};
+
+	// widening from a subset of the grades
+	template<size_t alt_grade_mask>
+	graded_multivector_t(const graded_multivector_t<scalar_t, space_mask, alt_grade_mask>& v) : components()
+	{
+		static_assert((alt_grade_mask & ~grade_mask) == 0, "Cannot drop grades implicitly, use grade_projection.");
+		for_each_graded_blade<space_mask, alt_grade_mask>::iterate<component_assign_helper>(*this, v);
+	}
+	template<size_t rank_size>
+	explicit graded_multivector_t(const multivector_t<scalar_t, space_mask, rank_size>& part) : components()
+	{
+		static_assert((grade_mask & (size_t(1) << rank_size)) != 0, "Grade not held by this multivector.");
+		load_part(part);
+	}
+	template<size_t... versor_ranks>
+	explicit graded_multivector_t(const versor_t<scalar_t, space_mask, versor_ranks...>& versor) : components()
+	{
+		static_assert((((grade_mask & (size_t(1) << versor_ranks)) != 0) && ...), "Grade not held by this multivector.");
+		std::apply([this](const auto&... parts) { (load_part(parts), ...); }, versor);
+	}
+
+	const graded_multivector_t& operator =(const graded_multivector_t& v) { components = v.components; return *this; };
+
+	versor_type to_versor() const
+	{
+		versor_type result;
+		std::apply([this](auto&... parts) { (store_part(parts), ...); }, result);
+		return std::move(result);
+	}
+	template<size_t rank_size>
+	multivector_t<scalar_t, space_mask, rank_size> get_part() const
+	{
+		multivector_t<scalar_t, space_mask, rank_size> part;
+		if constexpr ((grade_mask & (size_t(1) << rank_size)) != 0)
+			store_part(part);
+		return std::move(part);
+	}
+
+	template<size_t blade_mask>
+	constexpr scalar_t& get()
+	{
+		static_assert(traits::has_blade<blade_mask>::value, "Blade not held by this multivector.");
+		return components[traits::get_components_index<blade_mask>()];
+	}
+	template<size_t blade_mask>
+	constexpr scalar_t get() const
+	{
+		if constexpr (traits::has_blade<blade_mask>::value)
+			return components[traits::get_components_index<blade_mask>()];
+		else
+			return scalar_t(0);
+	}
+
+	components_type components;
+};
+
+template<typename scalar_t, size_t space_mask, size_t rank_size>
+inline auto make_graded(const multivector_t<scalar_t, space_mask, rank_size>& u)
+{
+	return graded_multivector_t<scalar_t, space_mask, (size_t(1) << rank_size)>(u);
+}
+template<typename scalar_t, size_t space_mask, size_t... versor_ranks>
+inline auto make_graded(const versor_t<scalar_t, space_mask, versor_ranks...>& versor)
+{
+	return graded_multivector_t<scalar_t, space_mask, ((size_t(1) << versor_ranks) | ...)>(versor);
+}
+
+
+//
+// Grade-wise operations
+// Sums hold the union of the grades of their operands, projections the intersection.
+//
+struct graded_sum_helper
+{
+	template<size_t blade_mask, size_t loop>
+	struct add
+	{
+		template<typename scalar_t, size_t space_mask, size_t grade_mask0, size_t grade_mask1, size_t grade_mask2>
+		add(graded_multivector_t<scalar_t, space_mask, grade_mask0>& result, const graded_multivector_t<scalar_t, space_mask, grade_mask1>& u, const graded_multivector_t<scalar_t, space_mask, grade_mask2>& v)
+		{
+			result.get<blade_mask>() = u.get<blade_mask>() + v.get<blade_mask>();
+		}
+	};
+	template<size_t blade_mask, size_t loop>
+	struct sub
+	{
+		template<typename scalar_t, size_t space_mask, size_t grade_mask0, size_t grade_mask1, size_t grade_mask2>
+		sub(graded_multivector_t<scalar_t, space_mask, grade_mask0>& result, const graded_multivector_t<scalar_t, space_mask, grade_mask1>& u, const graded_multivector_t<scalar_t, space_mask, grade_mask2>& v)
+		{
+			result.get<blade_mask>() = u.get<blade_mask>() - v.get<blade_mask>();
+		}
+	};
+	template<size_t blade_mask, size_t loop>
+	struct project
+	{
+		template<typename scalar_t, size_t space_mask, size_t grade_mask0, size_t grade_mask1>
+		project(graded_multivector_t<scalar_t, space_mask, grade_mask0>& result, const graded_multivector_t<scalar_t, space_mask, grade_mask1>& u)
+		{
+			result.get<blade_mask>() = u.get<blade_mask>();
+		}
+	};
+	template<size_t blade_mask, size_t loop>
+	struct reverse
+	{
+		template<typename scalar_t, size_t space_mask, size_t grade_mask>
+		reverse(graded_multivector_t<scalar_t, space_mask, grade_mask>& result, const graded_multivector_t<scalar_t, space_mask, grade_mask>& u)
+		{
+			if constexpr (SBLib::reversion_conjugacy_traits<blade_mask>::sign < 0)
+				result.get<blade_mask>() = -u.get<blade_mask>();
+			else
+				result.get<blade_mask>() = u.get<blade_mask>();
+		}
+	};
+};
+
+template<typename scalar_t, size_t space_mask, size_t grade_mask1, size_t grade_mask2>
+inline auto operator +(const graded_multivector_t<scalar_t, space_mask, grade_mask1>& u, const graded_multivector_t<scalar_t, space_mask, grade_mask2>& v)
+{
+	using result_type = graded_multivector_t<scalar_t, space_mask, (grade_mask1 | grade_mask2)>;
+	result_type result(result_type::UNINITIALIZED);
+	for_each_graded_blade<space_mask, (grade_mask1 | grade_mask2)>::iterate<graded_sum_helper::add>(result, u, v);
+	return std::move(result);
+}
+template<typename scalar_t, size_t space_mask, size_t grade_mask1, size_t grade_mask2>
+inline auto operator -(const graded_multivector_t<scalar_t, space_mask, grade_mask1>& u, const graded_multivector_t<scalar_t, space_mask, grade_mask2>& v)
+{
+	using result_type = graded_multivector_t<scalar_t, space_mask, (grade_mask1 | grade_mask2)>;
+	result_type result(result_type::UNINITIALIZED);
+	for_each_graded_blade<space_mask, (grade_mask1 | grade_mask2)>::iterate<graded_sum_helper::sub>(result, u, v);
+	return std::move(result);
+}
+template<typename scalar_t, size_t space_mask, size_t grade_mask>
+inline auto operator *(const graded_multivector_t<scalar_t, space_mask, grade_mask>& u, const scalar_t& scale)
+{
+	return graded_multivector_t<scalar_t, space_mask, grade_mask>(std::move(u.components * scale));
+}
+template<typename scalar_t, size_t space_mask, size_t grade_mask>
+inline auto operator *(const scalar_t& scale, const graded_multivector_t<scalar_t, space_mask, grade_mask>& u)
+{
+	return std::move(u * scale);
+}
+
+template<size_t projection_mask, typename scalar_t, size_t space_mask, size_t grade_mask>
+inline auto grade_projection(const graded_multivector_t<scalar_t, space_mask, grade_mask>& u)
+{
+	using result_type = graded_multivector_t<scalar_t, space_mask, (grade_mask & projection_mask)>;
+	result_type result(result_type::UNINITIALIZED);
+	for_each_graded_blade<space_mask, (grade_mask & projection_mask)>::iterate<graded_sum_helper::project>(result, u);
+	return std::move(result);
+}
+
+template<typename scalar_t, size_t space_mask, size_t grade_mask>
+inline auto reverse(const graded_multivector_t<scalar_t, space_mask, grade_mask>& u)
+{
+	using result_type = graded_multivector_t<scalar_t, space_mask, grade_mask>;
+	result_type result(result_type::UNINITIALIZED);
+	for_each_graded_blade<space_mask, grade_mask>::iterate<graded_sum_helper::reverse>(result, u);
+	return std::move(result);
+}
+
+
+//
+// Products
+// The grades of the result are computed from the grade sets of the operands :
+//	geometric   r1 * r2 -> |r1 - r2|, |r1 - r2| + 2, ..., min(r1 + r2, 2 n - r1 - r2) (c.f., get_geometric_grade_mask)
+//	exterior    r1 ^ r2 -> r1 + r2 (dropped if above n)
+// and each result component D sums u[A] v[A ^ D] over the blades A of u for which A ^ D is held by v, with the compile-time
+// sign of sign_policy (terms of sign 0 are dropped).
+//
+struct graded_product_traits
+{
+	static constexpr size_t get_exterior_grade_mask(size_t grade_mask1, size_t grade_mask2, size_t dimension_size)
+	{
+		size_t grade_mask = 0;
+		for (size_t first_rank = 0; first_rank <= dimension_size; ++first_rank)
+			for (size_t second_rank = 0; first_rank + second_rank <= dimension_size; ++second_rank)
+				if ((grade_mask1 & (size_t(1) << first_rank)) != 0 && (grade_mask2 & (size_t(1) << second_rank)) != 0)
+					grade_mask |= (size_t(1) << (first_rank + second_rank));
+		return grade_mask;
+	}
+};
+
+template<typename metric_type>
+struct geometric_sign_policy
+{
+	template<size_t first_mask, size_t second_mask>
+	static constexpr int get_sign() { return SBLib::geometric_traits<first_mask, second_mask, SBLib::default_basis_big_endian, metric_type>::sign; }
+};
+struct exterior_sign_policy
+{
+	template<size_t first_mask, size_t second_mask>
+	static constexpr int get_sign() { return SBLib::alternating_traits<first_mask, second_mask, SBLib::default_basis_big_endian>::sign; }
+};
+
+template<typename sign_policy, size_t grade_mask1, size_t grade_mask2>
+struct graded_product_helper
+{
+	template<size_t result_mask>
+	struct term_helper
+	{
+		template<size_t first_mask, size_t loop>
+		struct do_action
+		{
+			template<typename scalar_t, size_t space_mask>
+			do_action(scalar_t& result, const graded_multivector_t<scalar_t, space_mask, grade_mask1>& u, const graded_multivector_t<scalar_t, space_mask, grade_mask2>& v)
+			{
+				enum : size_t { second_mask = (first_mask ^ result_mask), };
+				if constexpr ((grade_mask2 & (size_t(1) << SBLib::bit_traits<second_mask>::population_count)) != 0)
+				{
+					enum : int { sign = sign_policy::get_sign<first_mask, second_mask>(), };
+					if constexpr (sign > 0)
+						result += u.get<first_mask>() * v.get<second_mask>();
+					else if constexpr (sign < 0)
+						result -= u.get<first_mask>() * v.get<second_mask>();
+				}
+			}
+		};
+	};
+
+	template<size_t result_mask, size_t index>
+	struct do_action
+	{
+		template<typename scalar_t, size_t space_mask, size_t result_grade_mask>
+		do_action(graded_multivector_t<scalar_t, space_mask, result_grade_mask>& result, const graded_multivector_t<scalar_t, space_mask, grade_mask1>& u, const graded_multivector_t<scalar_t, space_mask, grade_mask2>& v)
+		{
+			scalar_t& value = result.get<result_mask>();
+			value = scalar_t(0);
+			for_each_graded_blade<space_mask, grade_mask1>::iterate<term_helper<result_mask>::do_action>(value, u, v);
+		}
+	};
+};
+
+template<typename metric_type = SBLib::euclidian_metric, typename scalar_t, size_t space_mask, size_t grade_mask1, size_t grade_mask2>
+auto geometric_product(const graded_multivector_t<scalar_t, space_mask, grade_mask1>& u, const graded_multivector_t<scalar_t, space_mask, grade_mask2>& v)
+{
+	enum : size_t { grade_mask = get_geometric_grade_mask(grade_mask1, grade_mask2, SBLib::bit_traits<space_mask>::population_count), };
+	using result_type = graded_multivector_t<scalar_t, space_mask, grade_mask>;
+	result_type result(result_type::UNINITIALIZED);
+	for_each_graded_blade<space_mask, grade_mask>::iterate<graded_product_helper<geometric_sign_policy<metric_type>, grade_mask1, grade_mask2>::do_action>(result, u, v);
+	return std::move(result);
+}
+template<typename scalar_t, size_t space_mask, size_t grade_mask1, size_t grade_mask2>
+auto operator *(const graded_multivector_t<scalar_t, space_mask, grade_mask1>& u, const graded_multivector_t<scalar_t, space_mask, grade_mask2>& v)
+{
+	return geometric_product(u, v);
+}
+
+template<typename scalar_t, size_t space_mask, size_t grade_mask1, size_t grade_mask2>
+auto wedge_product(const graded_multivector_t<scalar_t, space_mask, grade_mask1>& u, const graded_multivector_t<scalar_t, space_mask, grade_mask2>& v)
+{
+	enum : size_t { grade_mask = graded_product_traits::get_exterior_grade_mask(grade_mask1, grade_mask2, SBLib::bit_traits<space_mask>::population_count), };
+	using result_type = graded_multivector_t<scalar_t, space_mask, grade_mask>;
+	result_type result(result_type::UNINITIALIZED);
+	for_each_graded_blade<space_mask, grade_mask>::iterate<graded_product_helper<exterior_sign_policy, grade_mask1, grade_mask2>::do_action>(result, u, v);
+	return std::move(result);
+}
+template<typename scalar_t, size_t space_mask, size_t grade_mask1, size_t grade_mask2>
+auto operator ^(const graded_multivector_t<scalar_t, space_mask, grade_mask1>& u, const graded_multivector_t<scalar_t, space_mask, grade_mask2>& v)
+{
+	return std::move(wedge_product(u, v));
+}
+} // namespace SBLib::Mathematics
+namespace SBLib { using namespace Mathematics; }
@@ -146,10 +146,10 @@ inline const auto& operator /=(multivector_t<scalar_t, space_mask, rank_size>& u
 template<typename scalar_t, size_t space_mask, size_t rank_size>
 inline auto operator /(const multivector_t<scalar_t, space_mask, rank_size>& u, const scalar_t& scale)
 {
-	return multivector_t<scalar_t, space_mask, rank_size>(std::move(v.components / scale));
+	return multivector_t<scalar_t, space_mask, rank_size>(std::move(u.components / scale));
 }
 template<typename scalar_t, size_t space_mask, size_t rank_size>
-inline const auto& operator +=(multivector_t<scalar_t, space_mask, rank_size>& u, multivector_t<scalar_t, space_mask, rank_size>& v)
+inline const auto& operator +=(multivector_t<scalar_t, space_mask, rank_size>& u, const multivector_t<scalar_t, space_mask, rank_size>& v)
 {
 	return u.components += v.components;
 }
@@ -158,6 +158,16 @@ inline auto operator +(const multivector_t<scalar_t, space_mask, rank_size>& u,
 {
 	return multivector_t<scalar_t, space_mask, rank_size>(std::move(u.components + v.components));
 }
+template<typename scalar_t, size_t space_mask, size_t rank_size>
+inline const auto& operator -=(multivector_t<scalar_t, space_mask, rank_size>& u, const multivector_t<scalar_t, space_mask, rank_size>& v)
+{
+	return u.components -= v.components;
+}
+template<typename scalar_t, size_t space_mask, size_t rank_size>
+inline auto operator -(const multivector_t<scalar_t, space_mask, rank_size>& u, const multivector_t<scalar_t, space_mask, rank_size>& v)
+{
+	return multivector_t<scalar_t, space_mask, rank_size>(std::move(u.components - v.components));
+}
 
 //
 // vector_t specialization
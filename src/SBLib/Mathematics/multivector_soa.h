@@ -0,0 +1,50 @@
+#pragma once
+#include <Mathematics/multivector.h>
+#include <array>
+namespace SBLib::Mathematics
+{
+//
+// multivector_soa_t
+// Structure-of-arrays view over a batch of multivectors of the same type : one contiguous stream per component.
+// Batch kernels walk all streams with the same index so that consecutive elements land in consecutive SIMD lanes.
+// The view does not own its streams.
+//
+template<typename scalar_t, size_t space_mask, size_t rank_size>
+struct multivector_soa_t
+{
+public:
+	using multivector_type = multivector_t<scalar_t, space_mask, rank_size>;
+	enum : size_t
+	{
+		space_mask     = space_mask,
+		dimension_size = multivector_type::dimension_size,
+		rank_size      = rank_size,
+	};
+	using scalar_type  = scalar_t;
+	using streams_type = std::array<scalar_type*, dimension_size>;
+
+	multivector_soa_t(const streams_type& streams, size_t count) : components(streams), count(count) {}
+
+	size_t size() const { return count; }
+
+	multivector_type load(size_t index) const
+	{
+		multivector_type v(multivector_type::UNINITIALIZED);
+		for (size_t component = 0; component < dimension_size; ++component)
+			v.components[component] = components[component][index];
+		return std::move(v);
+	}
+	void store(size_t index, const multivector_type& v) const
+	{
+		for (size_t component = 0; component < dimension_size; ++component)
+			components[component][index] = v.components[component];
+	}
+
+	streams_type components;
+	size_t count;
+};
+
+template<typename scalar_t, size_t space_mask>
+using vector_soa_t = multivector_soa_t<scalar_t, space_mask, 1>;
+} // namespace SBLib::Mathematics
+namespace SBLib { using namespace Mathematics; }
@@ -0,0 +1,303 @@
+#pragma once
+#include <Mathematics/geometric_product.h>
+#include <Mathematics/multivector_soa.h>
+#include <Traits/clifford_traits.h>
+#include <array>
+#include <cmath>
+#include <type_traits>
+
+#if !defined(USE_SSE_RSQRT)
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE__)
+#define USE_SSE_RSQRT 1
+#else
+#define USE_SSE_RSQRT 0
+#endif
+#endif // #if !defined(USE_SSE_RSQRT)
+
+#if USE_SSE_RSQRT
+#include <xmmintrin.h>
+#endif // #if USE_SSE_RSQRT
+
+namespace SBLib::Mathematics
+{
+//
+// reciprocal_sqrt
+// 1 / sqrt(x). Floats use the rsqrt estimate (12 bits) refined by one Newton step y (3 - x y^2) / 2 (~23 bits), which
+// replaces a square root and a division. Other scalars use the exact expression.
+//
+template<typename scalar_t>
+inline scalar_t reciprocal_sqrt(const scalar_t& x)
+{
+	return scalar_t(1) / std::sqrt(x);
+}
+#if USE_SSE_RSQRT
+inline __m128 reciprocal_sqrt(__m128 x)
+{
+	const __m128 estimate = _mm_rsqrt_ps(x);
+	const __m128 half_x   = _mm_mul_ps(_mm_set1_ps(0.5f), x);
+	return _mm_mul_ps(estimate, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(half_x, _mm_mul_ps(estimate, estimate))));
+}
+inline float reciprocal_sqrt(const float& x)
+{
+	return _mm_cvtss_f32(reciprocal_sqrt(_mm_set_ss(x)));
+}
+#endif // #if USE_SSE_RSQRT
+
+
+//
+// versor_norm_helper
+// V V~ = sum over blades A of V[A]^2 e_A e_A~ for versors (the cross terms cancel), where e_A e_A~ is the product of the
+// squares of the basis vectors of A : +1 in Euclidian space, -1 for an odd count of negative vectors and 0 with null ones.
+//
+template<typename metric_type>
+struct versor_norm_helper
+{
+	template<size_t blade_mask>
+	static constexpr int get_sign()
+	{
+		return SBLib::geometric_traits<blade_mask, blade_mask, SBLib::default_basis_big_endian, metric_type>::sign * SBLib::reversion_conjugacy_traits<blade_mask>::sign;
+	}
+
+	template<size_t blade_mask, size_t index>
+	struct accumulate
+	{
+		template<typename scalar_t, size_t space_mask, size_t rank_size>
+		accumulate(scalar_t& result, const multivector_t<scalar_t, space_mask, rank_size>& v)
+		{
+			if constexpr (get_sign<blade_mask>() > 0)
+				result += v.components[index] * v.components[index];
+			else if constexpr (get_sign<blade_mask>() < 0)
+				result -= v.components[index] * v.components[index];
+		}
+	};
+	template<size_t blade_mask, size_t index>
+	struct get_signs
+	{
+		template<typename scalar_t, size_t component_count>
+		get_signs(std::array<scalar_t, component_count>& signs, size_t offset)
+		{
+			signs[offset + index] = scalar_t(get_sign<blade_mask>());
+		}
+	};
+};
+
+//
+// norm_squared
+// Scalar V V~ of a versor (or of a blade).
+//
+template<typename metric_type = SBLib::euclidian_metric, typename scalar_t, size_t space_mask, size_t... versor_ranks>
+inline scalar_t norm_squared(const versor_t<scalar_t, space_mask, versor_ranks...>& versor)
+{
+	scalar_t result = scalar_t(0);
+	(SBLib::for_each_combination< SBLib::select_combinations<space_mask, versor_ranks> >::iterate<versor_norm_helper<metric_type>::accumulate>(result, std::get<multivector_t<scalar_t, space_mask, versor_ranks>>(versor)), ...);
+	return result;
+}
+template<typename metric_type = SBLib::euclidian_metric, typename scalar_t, size_t space_mask, size_t rank_size>
+inline scalar_t norm_squared(const multivector_t<scalar_t, space_mask, rank_size>& blade)
+{
+	scalar_t result = scalar_t(0);
+	SBLib::for_each_combination< SBLib::select_combinations<space_mask, rank_size> >::iterate<versor_norm_helper<metric_type>::accumulate>(result, blade);
+	return result;
+}
+
+//
+// normalize / inverse
+// normalize(V) = V / sqrt(|V V~|) and inverse(V) = V~ / (V V~), both through a single reciprocal_sqrt. These hold for
+// versors and blades, for which V V~ is a scalar; general_inverse below handles any invertible multivector.
+//
+template<typename scalar_t, size_t space_mask, size_t... versor_ranks>
+inline auto& operator *=(versor_t<scalar_t, space_mask, versor_ranks...>& versor, const scalar_t& scale)
+{
+	((std::get<multivector_t<scalar_t, space_mask, versor_ranks>>(versor) *= scale), ...);
+	return versor;
+}
+template<typename metric_type = SBLib::euclidian_metric, typename scalar_t, size_t space_mask, size_t... versor_ranks>
+inline auto normalize(const versor_t<scalar_t, space_mask, versor_ranks...>& versor)
+{
+	versor_t<scalar_t, space_mask, versor_ranks...> result(versor);
+	result *= reciprocal_sqrt(std::abs(norm_squared<metric_type>(versor)));
+	return std::move(result);
+}
+template<typename metric_type = SBLib::euclidian_metric, typename scalar_t, size_t space_mask, size_t... versor_ranks>
+inline auto inverse(const versor_t<scalar_t, space_mask, versor_ranks...>& versor)
+{
+	const scalar_t norm2 = norm_squared<metric_type>(versor);
+	const scalar_t scale = reciprocal_sqrt(std::abs(norm2));
+	auto result = reverse(versor);
+	result *= (norm2 < scalar_t(0)) ? -scale * scale : scale * scale;
+	return std::move(result);
+}
+template<typename metric_type = SBLib::euclidian_metric, typename scalar_t, size_t space_mask, size_t rank_size>
+inline auto normalize(const multivector_t<scalar_t, space_mask, rank_size>& blade)
+{
+	return std::move(blade * reciprocal_sqrt(std::abs(norm_squared<metric_type>(blade))));
+}
+template<typename metric_type = SBLib::euclidian_metric, typename scalar_t, size_t space_mask, size_t rank_size>
+inline auto inverse(const multivector_t<scalar_t, space_mask, rank_size>& blade)
+{
+	const scalar_t norm2 = norm_squared<metric_type>(blade);
+	const scalar_t scale = reciprocal_sqrt(std::abs(norm2));
+	const int sign = ((norm2 < scalar_t(0)) ? -1 : +1) * SBLib::reversion_conjugacy_traits<((size_t(1) << rank_size) - 1)>::sign;
+	return std::move(blade * (scalar_t(sign) * scale * scale));
+}
+
+
+//
+// general_inverse
+// Inverse of any invertible multivector in up to 5 dimensions, from the closed forms of Hitzer and Sangwine with the
+// Clifford conjugate x-, grade involution x^ and reversion x~ :
+//	n <= 2  x^-1 = x- / (x x-)
+//	n = 3   x^-1 = x- x^ x~ / (x x- x^ x~)
+//	n = 4   x^-1 = x- m(x x-) / (x x- m(x x-))              with m negating grades 3 and 4
+//	n = 5   x^-1 = x- x^ x~ m(x x- x^ x~) / (x x- x^ x~ m(...))  with m negating grades 1 and 4
+// Each denominator is a scalar. The result holds every grade the products can reach.
+//
+struct grade_negation_masks
+{
+	enum : size_t
+	{
+		grade_involution     = size_t(0xAAAAAAAAAAAAAAAAull), // grades 1, 3, 5, ...
+		reversion            = size_t(0xCCCCCCCCCCCCCCCCull), // grades 2, 3, 6, 7, ...
+		clifford_conjugation = size_t(0x6666666666666666ull), // grades 1, 2, 5, 6, ...
+		inverse_4            = (1 << 3) | (1 << 4),
+		inverse_5            = (1 << 1) | (1 << 4),
+	};
+};
+template<size_t grade_mask, typename scalar_t, size_t space_mask, size_t... versor_ranks>
+inline auto negate_grades(const versor_t<scalar_t, space_mask, versor_ranks...>& versor)
+{
+	versor_t<scalar_t, space_mask, versor_ranks...> result(versor);
+	((((grade_mask >> versor_ranks) & 1) != 0 ? void(std::get<multivector_t<scalar_t, space_mask, versor_ranks>>(result) *= scalar_t(-1)) : void()), ...);
+	return std::move(result);
+}
+template<typename scalar_t, size_t space_mask, size_t... versor_ranks>
+inline scalar_t get_scalar_part(const versor_t<scalar_t, space_mask, versor_ranks...>& versor)
+{
+	using traits = versor_part_traits<0, versor_ranks...>;
+	if constexpr (traits::has_part)
+		return std::get<traits::part_index>(versor).components[0];
+	else
+		return scalar_t(0);
+}
+
+template<typename metric_type = SBLib::euclidian_metric, typename scalar_t, size_t space_mask, size_t... versor_ranks>
+inline auto general_inverse(const versor_t<scalar_t, space_mask, versor_ranks...>& x)
+{
+	enum : size_t { dimension_size = SBLib::bit_traits<space_mask>::population_count, };
+	static_assert(dimension_size <= 5, "Closed-form inverses are only available up to 5 dimensions.");
+	using masks = grade_negation_masks;
+	const auto x_conjugate = negate_grades<masks::clifford_conjugation>(x);
+	auto get_inverse = [&x](auto numerator)
+	{
+		numerator *= scalar_t(1) / get_scalar_part(geometric_product<metric_type>(x, numerator));
+		return std::move(numerator);
+	};
+	if constexpr (dimension_size <= 2)
+	{
+		return get_inverse(x_conjugate);
+	}
+	else if constexpr (dimension_size == 3)
+	{
+		return get_inverse(geometric_product<metric_type>(geometric_product<metric_type>(x_conjugate, negate_grades<masks::grade_involution>(x)), reverse(x)));
+	}
+	else if constexpr (dimension_size == 4)
+	{
+		return get_inverse(geometric_product<metric_type>(x_conjugate, negate_grades<masks::inverse_4>(geometric_product<metric_type>(x, x_conjugate))));
+	}
+	else
+	{
+		const auto y = geometric_product<metric_type>(geometric_product<metric_type>(x_conjugate, negate_grades<masks::grade_involution>(x)), reverse(x));
+		return get_inverse(geometric_product<metric_type>(y, negate_grades<masks::inverse_5>(geometric_product<metric_type>(x, y))));
+	}
+}
+
+
+//
+// Batch versions over structure-of-arrays streams
+// Every component stream of the versors is read once and written once : the squared norms of four versors are accumulated
+// in a register from all streams, scaled by one packed reciprocal_sqrt and written back while the streams are still in L1.
+//
+template<typename metric_type, bool is_inverse>
+struct versor_normalization_kernel
+{
+	template<typename scalar_t, size_t component_count>
+	struct streams_t
+	{
+		std::array<const scalar_t*, component_count> sources;
+		std::array<scalar_t*, component_count> destinations;
+		std::array<scalar_t, component_count> norm_signs;
+		std::array<scalar_t, component_count> result_signs;
+	};
+
+	template<size_t rank_size, typename streams_type, typename scalar_t, size_t space_mask>
+	static void add_part(streams_type& streams, size_t& offset, const multivector_soa_t<scalar_t, space_mask, rank_size>& result, const multivector_soa_t<scalar_t, space_mask, rank_size>& versors)
+	{
+		SBLib::for_each_combination< SBLib::select_combinations<space_mask, rank_size> >::iterate<versor_norm_helper<metric_type>::get_signs>(streams.norm_signs, offset);
+		for (size_t index = 0; index < multivector_soa_t<scalar_t, space_mask, rank_size>::dimension_size; ++index)
+		{
+			streams.sources[offset + index]      = versors.components[index];
+			streams.destinations[offset + index] = result.components[index];
+			streams.result_signs[offset + index] = (is_inverse && SBLib::reversion_conjugacy_traits<((size_t(1) << rank_size) - 1)>::sign < 0) ? scalar_t(-1) : scalar_t(1);
+		}
+		offset += multivector_soa_t<scalar_t, space_mask, rank_size>::dimension_size;
+	}
+
+	template<typename scalar_t, size_t space_mask, size_t... versor_ranks>
+	static void apply(const versor_soa_t<scalar_t, space_mask, versor_ranks...>& result, const versor_soa_t<scalar_t, space_mask, versor_ranks...>& versors)
+	{
+		enum : size_t { component_count = (multivector_soa_t<scalar_t, space_mask, versor_ranks>::dimension_size + ...), };
+		streams_t<scalar_t, component_count> streams;
+		size_t offset = 0;
+		(add_part<versor_ranks>(streams, offset, std::get<multivector_soa_t<scalar_t, space_mask, versor_ranks>>(result), std::get<multivector_soa_t<scalar_t, space_mask, versor_ranks>>(versors)), ...);
+
+		const size_t count = std::get<0>(versors).size();
+		size_t index = 0;
+#if USE_SSE_RSQRT
+		if constexpr (std::is_same_v<scalar_t, float>)
+		{
+			const __m128 sign_mask = _mm_set1_ps(-0.0f);
+			for (; index + 4 <= count; index += 4)
+			{
+				__m128 norm2 = _mm_setzero_ps();
+				for (size_t component = 0; component < component_count; ++component)
+				{
+					const __m128 x = _mm_loadu_ps(streams.sources[component] + index);
+					norm2 = _mm_add_ps(norm2, _mm_mul_ps(_mm_set1_ps(streams.norm_signs[component]), _mm_mul_ps(x, x)));
+				}
+				__m128 scale = reciprocal_sqrt(_mm_andnot_ps(sign_mask, norm2));
+				if constexpr (is_inverse)
+					scale = _mm_xor_ps(_mm_mul_ps(scale, scale), _mm_and_ps(sign_mask, norm2));
+				for (size_t component = 0; component < component_count; ++component)
+				{
+					const __m128 x = _mm_loadu_ps(streams.sources[component] + index);
+					_mm_storeu_ps(streams.destinations[component] + index, _mm_mul_ps(_mm_mul_ps(x, scale), _mm_set1_ps(streams.result_signs[component])));
+				}
+			}
+		}
+#endif // #if USE_SSE_RSQRT
+		for (; index < count; ++index)
+		{
+			scalar_t norm2 = scalar_t(0);
+			for (size_t component = 0; component < component_count; ++component)
+				norm2 += streams.norm_signs[component] * streams.sources[component][index] * streams.sources[component][index];
+			scalar_t scale = reciprocal_sqrt(std::abs(norm2));
+			if constexpr (is_inverse)
+				scale = (norm2 < scalar_t(0)) ? -scale * scale : scale * scale;
+			for (size_t component = 0; component < component_count; ++component)
+				streams.destinations[component][index] = streams.sources[component][index] * scale * streams.result_signs[component];
+		}
+	}
+};
+
+template<typename metric_type = SBLib::euclidian_metric, typename scalar_t, size_t space_mask, size_t... versor_ranks>
+inline void normalize(const versor_soa_t<scalar_t, space_mask, versor_ranks...>& result, const versor_soa_t<scalar_t, space_mask, versor_ranks...>& versors)
+{
+	versor_normalization_kernel<metric_type, false>::apply(result, versors);
+}
+template<typename metric_type = SBLib::euclidian_metric, typename scalar_t, size_t space_mask, size_t... versor_ranks>
+inline void inverse(const versor_soa_t<scalar_t, space_mask, versor_ranks...>& result, const versor_soa_t<scalar_t, space_mask, versor_ranks...>& versors)
+{
+	versor_normalization_kernel<metric_type, true>::apply(result, versors);
+}
+} // namespace SBLib::Mathematics
+namespace SBLib { using namespace Mathematics; }
@@ -0,0 +1,129 @@
+#pragma once
+#include <Mathematics/determinant.h>
+#include <Mathematics/multivector.h>
+#include <Mathematics/multivector_soa.h>
+#include <Traits/clifford_traits.h>
+#include <array>
+
+namespace SBLib::Mathematics
+{
+//
+// outermorphism_t
+// Action of a linear map f on rank-k multivectors, f(u ^ v) = f(u) ^ f(v), stored as its k-th compound matrix : column j is
+// the image of the j-th basis blade of select_combinations<space_mask, rank_size> and rows follow the same component order.
+// Applying it is a single small matrix-vector product per element instead of wedging transformed basis vectors.
+//
+// The rank-1 outermorphism is the linear map itself (columns are the images of the basis vectors, c.f., linear_map_t).
+//
+template<typename scalar_t, size_t space_mask, size_t rank_size>
+struct outermorphism_t
+{
+public:
+	using multivector_type = multivector_t<scalar_t, space_mask, rank_size>;
+	enum : size_t
+	{
+		space_mask     = space_mask,
+		dimension_size = multivector_type::dimension_size,
+		rank_size      = rank_size,
+	};
+	using scalar_type  = scalar_t;
+	using columns_type = std::array<multivector_type, dimension_size>;
+
+	multivector_type operator()(const multivector_type& v) const
+	{
+		multivector_type result(multivector_type::UNINITIALIZED);
+		for (size_t row = 0; row < dimension_size; ++row)
+		{
+			scalar_t value = columns[0].components[row] * v.components[0];
+			for (size_t column = 1; column < dimension_size; ++column)
+				value += columns[column].components[row] * v.components[column];
+			result.components[row] = value;
+		}
+		return std::move(result);
+	}
+
+	columns_type columns;
+};
+
+template<typename scalar_t, size_t space_mask>
+using linear_map_t = outermorphism_t<scalar_t, space_mask, 1>;
+
+
+//
+// Compound matrix construction
+// The column of blade B is built from the rank-(k-1) column of B without its last bit b, wedged with the image of e_b :
+//	f(e_B) = sign(B - b, b) * f(e_(B - b)) ^ f(e_b)
+// so every minor of rank k - 1 is reused by all the rank-k minors containing it.
+//
+template<size_t rank_size>
+struct outermorphism_column_helper
+{
+	template<size_t blade_mask, size_t index>
+	struct do_action
+	{
+		template<typename scalar_t, size_t space_mask>
+		do_action(outermorphism_t<scalar_t, space_mask, rank_size>& result, const outermorphism_t<scalar_t, space_mask, rank_size - 1>& lower, const linear_map_t<scalar_t, space_mask>& matrix)
+		{
+			enum : size_t
+			{
+				last_bit     = SBLib::bit_traits<blade_mask>::get_bit<rank_size - 1>(),
+				lower_mask   = (blade_mask & ~last_bit),
+				lower_index  = SBLib::combinations<space_mask>::select<rank_size - 1>::get_components_index<lower_mask>(),
+				vector_index = SBLib::bit_traits<space_mask>::get_bit_component<last_bit>(),
+			};
+			enum : int { sign = SBLib::alternating_traits<lower_mask, last_bit>::sign, };
+			result.columns[index] = wedge_all(lower.columns[lower_index], matrix.columns[vector_index]);
+			if constexpr (sign < 0)
+				result.columns[index] *= scalar_t(-1);
+		}
+	};
+};
+
+template<typename scalar_t, size_t space_mask, size_t rank_size>
+inline auto outermorphism(const outermorphism_t<scalar_t, space_mask, rank_size>& lower, const linear_map_t<scalar_t, space_mask>& matrix)
+{
+	static_assert(rank_size + 1 <= SBLib::bit_traits<space_mask>::population_count, "Invalid rank");
+	outermorphism_t<scalar_t, space_mask, rank_size + 1> result;
+	SBLib::for_each_combination< SBLib::select_combinations<space_mask, rank_size + 1> >::iterate<outermorphism_column_helper<rank_size + 1>::do_action>(result, lower, matrix);
+	return std::move(result);
+}
+
+template<size_t rank_size, typename scalar_t, size_t space_mask>
+inline auto outermorphism(const linear_map_t<scalar_t, space_mask>& matrix)
+{
+	static_assert(rank_size <= SBLib::bit_traits<space_mask>::population_count, "Invalid rank");
+	if constexpr (rank_size == 0)
+	{
+		outermorphism_t<scalar_t, space_mask, 0> result;
+		result.columns[0].components[0] = scalar_t(1);
+		return std::move(result);
+	}
+	else if constexpr (rank_size == 1)
+	{
+		return matrix;
+	}
+	else
+	{
+		return outermorphism(outermorphism<rank_size - 1>(matrix), matrix);
+	}
+}
+
+
+//
+// Batch application
+//
+template<typename scalar_t, size_t space_mask, size_t rank_size>
+inline void apply(const outermorphism_t<scalar_t, space_mask, rank_size>& f, multivector_t<scalar_t, space_mask, rank_size>* result, const multivector_t<scalar_t, space_mask, rank_size>* v, size_t count)
+{
+	for (size_t index = 0; index < count; ++index)
+		result[index] = f(v[index]);
+}
+template<typename scalar_t, size_t space_mask, size_t rank_size>
+inline void apply(const outermorphism_t<scalar_t, space_mask, rank_size>& f, const multivector_soa_t<scalar_t, space_mask, rank_size>& result, const multivector_soa_t<scalar_t, space_mask, rank_size>& v)
+{
+	const size_t count = v.size();
+	for (size_t index = 0; index < count; ++index)
+		result.store(index, f(v.load(index)));
+}
+} // namespace SBLib::Mathematics
+namespace SBLib { using namespace Mathematics; }
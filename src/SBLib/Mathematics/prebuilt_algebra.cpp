@@ -0,0 +1,12 @@
+#define SBLIB_BUILDING_PREBUILT_ALGEBRA
+#include <Mathematics/prebuilt_algebra.h>
+
+//
+// Explicit instantiation definitions of the prebuilt algebra (c.f., prebuilt_algebra.h), compiled into SBLib_prebuilt.lib.
+// It must be compiled with the same options as the code linking it : SBLib_prebuilt.vcxproj mirrors the SBLib.vcxproj settings.
+//
+namespace SBLib::Mathematics
+{
+SBLIB_PREBUILT_ALGEBRA(template, float)
+SBLIB_PREBUILT_ALGEBRA(template, double)
+} // namespace SBLib::Mathematics
@@ -0,0 +1,82 @@
+#pragma once
+#include <Mathematics/exterior_algebra.h>
+#include <Mathematics/geometric_product.h>
+
+//
+// Prebuilt algebra
+// multivector_t of every rank with the wedge and regressive products, Hodge conjugates and Euclidian geometric products of
+// the 2-D to 5-D float and double spaces (space masks (1 << n) - 1) are compiled once in SBLib_prebuilt.lib (c.f.,
+// prebuilt_algebra.cpp). Including this header declares them extern template : dependent translation units link those
+// instantiations instead of instantiating the product helpers again. Other spaces, metrics and scalar types are instantiated
+// as usual, and translation units not including this header are not affected.
+// combinations and the traits only hold compile-time constants, which cannot be prebuilt.
+//
+namespace SBLib::Mathematics
+{
+//
+// Rank lists
+// SBLIB_PREBUILT_RANK_SUM_k   : every rank pair (rank_size1, rank_size2) with rank_size1 + rank_size2 == k,
+// SBLIB_PREBUILT_RANK_SUMS_k  : every rank pair with rank_size1 + rank_size2 <= k,
+// each pair expanded as instantiation_macro(instantiation, scalar_t, dimension_size, rank_size1, rank_size2).
+//
+#define SBLIB_PREBUILT_RANK_SUM_0(X, instantiation, scalar_t, n) X(instantiation, scalar_t, n, 0, 0)
+#define SBLIB_PREBUILT_RANK_SUM_1(X, instantiation, scalar_t, n) X(instantiation, scalar_t, n, 0, 1) X(instantiation, scalar_t, n, 1, 0)
+#define SBLIB_PREBUILT_RANK_SUM_2(X, instantiation, scalar_t, n) X(instantiation, scalar_t, n, 0, 2) X(instantiation, scalar_t, n, 1, 1) X(instantiation, scalar_t, n, 2, 0)
+#define SBLIB_PREBUILT_RANK_SUM_3(X, instantiation, scalar_t, n) X(instantiation, scalar_t, n, 0, 3) X(instantiation, scalar_t, n, 1, 2) X(instantiation, scalar_t, n, 2, 1) X(instantiation, scalar_t, n, 3, 0)
+#define SBLIB_PREBUILT_RANK_SUM_4(X, instantiation, scalar_t, n) X(instantiation, scalar_t, n, 0, 4) X(instantiation, scalar_t, n, 1, 3) X(instantiation, scalar_t, n, 2, 2) X(instantiation, scalar_t, n, 3, 1) X(instantiation, scalar_t, n, 4, 0)
+#define SBLIB_PREBUILT_RANK_SUM_5(X, instantiation, scalar_t, n) X(instantiation, scalar_t, n, 0, 5) X(instantiation, scalar_t, n, 1, 4) X(instantiation, scalar_t, n, 2, 3) X(instantiation, scalar_t, n, 3, 2) X(instantiation, scalar_t, n, 4, 1) X(instantiation, scalar_t, n, 5, 0)
+
+#define SBLIB_PREBUILT_RANK_SUMS_0(X, instantiation, scalar_t, n) SBLIB_PREBUILT_RANK_SUM_0(X, instantiation, scalar_t, n)
+#define SBLIB_PREBUILT_RANK_SUMS_1(X, instantiation, scalar_t, n) SBLIB_PREBUILT_RANK_SUMS_0(X, instantiation, scalar_t, n) SBLIB_PREBUILT_RANK_SUM_1(X, instantiation, scalar_t, n)
+#define SBLIB_PREBUILT_RANK_SUMS_2(X, instantiation, scalar_t, n) SBLIB_PREBUILT_RANK_SUMS_1(X, instantiation, scalar_t, n) SBLIB_PREBUILT_RANK_SUM_2(X, instantiation, scalar_t, n)
+#define SBLIB_PREBUILT_RANK_SUMS_3(X, instantiation, scalar_t, n) SBLIB_PREBUILT_RANK_SUMS_2(X, instantiation, scalar_t, n) SBLIB_PREBUILT_RANK_SUM_3(X, instantiation, scalar_t, n)
+#define SBLIB_PREBUILT_RANK_SUMS_4(X, instantiation, scalar_t, n) SBLIB_PREBUILT_RANK_SUMS_3(X, instantiation, scalar_t, n) SBLIB_PREBUILT_RANK_SUM_4(X, instantiation, scalar_t, n)
+#define SBLIB_PREBUILT_RANK_SUMS_5(X, instantiation, scalar_t, n) SBLIB_PREBUILT_RANK_SUMS_4(X, instantiation, scalar_t, n) SBLIB_PREBUILT_RANK_SUM_5(X, instantiation, scalar_t, n)
+
+//
+// Instantiations for one rank pair (rank_size1, rank_size2) of an n-D space. Pairs with rank_size1 + rank_size2 <= n are
+// those of the wedge product ; their complements (n - rank_size1, n - rank_size2) are those of the regressive product. The
+// geometric product takes every pair : those with rank_size1 + rank_size2 <= n and the complements of those below n.
+//
+#define SBLIB_PREBUILT_SPACE_MASK(n) ((size_t(1) << (n)) - 1)
+
+#define SBLIB_PREBUILT_MULTIVECTOR(instantiation, scalar_t, n, rank_size, unused) \
+	instantiation struct multivector_t<scalar_t, SBLIB_PREBUILT_SPACE_MASK(n), rank_size>; \
+	instantiation multivector_t<scalar_t, SBLIB_PREBUILT_SPACE_MASK(n), (n) - (rank_size)> hodge_conjugate<euclidian_metric>(const multivector_t<scalar_t, SBLIB_PREBUILT_SPACE_MASK(n), rank_size>&);
+
+#define SBLIB_PREBUILT_GEOMETRIC_PRODUCT(instantiation, scalar_t, n, rank_size1, rank_size2) \
+	instantiation geometric_product_t<euclidian_metric, scalar_t, SBLIB_PREBUILT_SPACE_MASK(n), rank_size1, rank_size2> geometric_product<euclidian_metric>( \
+		const multivector_t<scalar_t, SBLIB_PREBUILT_SPACE_MASK(n), rank_size1>&, const multivector_t<scalar_t, SBLIB_PREBUILT_SPACE_MASK(n), rank_size2>&);
+
+#define SBLIB_PREBUILT_PRODUCTS(instantiation, scalar_t, n, rank_size1, rank_size2) \
+	instantiation multivector_t<scalar_t, SBLIB_PREBUILT_SPACE_MASK(n), (rank_size1) + (rank_size2)> wedge_product( \
+		const multivector_t<scalar_t, SBLIB_PREBUILT_SPACE_MASK(n), rank_size1>&, const multivector_t<scalar_t, SBLIB_PREBUILT_SPACE_MASK(n), rank_size2>&); \
+	instantiation multivector_t<scalar_t, SBLIB_PREBUILT_SPACE_MASK(n), (n) - (rank_size1) - (rank_size2)> regressive_product( \
+		const multivector_t<scalar_t, SBLIB_PREBUILT_SPACE_MASK(n), (n) - (rank_size1)>&, const multivector_t<scalar_t, SBLIB_PREBUILT_SPACE_MASK(n), (n) - (rank_size2)>&); \
+	SBLIB_PREBUILT_GEOMETRIC_PRODUCT(instantiation, scalar_t, n, rank_size1, rank_size2)
+
+#define SBLIB_PREBUILT_DUAL_GEOMETRIC_PRODUCT(instantiation, scalar_t, n, rank_size1, rank_size2) \
+	SBLIB_PREBUILT_GEOMETRIC_PRODUCT(instantiation, scalar_t, n, (n) - (rank_size1), (n) - (rank_size2))
+
+#define SBLIB_PREBUILT_SPACE(instantiation, scalar_t, n, rank_sum, lower_rank_sums, rank_sums) \
+	rank_sum(SBLIB_PREBUILT_MULTIVECTOR, instantiation, scalar_t, n) \
+	rank_sums(SBLIB_PREBUILT_PRODUCTS, instantiation, scalar_t, n) \
+	lower_rank_sums(SBLIB_PREBUILT_DUAL_GEOMETRIC_PRODUCT, instantiation, scalar_t, n)
+
+//
+// SBLIB_PREBUILT_ALGEBRA(instantiation, scalar_t)
+// Every prebuilt instantiation for one scalar type, with instantiation either 'extern template' (declarations) or 'template'
+// (definitions).
+//
+#define SBLIB_PREBUILT_ALGEBRA(instantiation, scalar_t) \
+	SBLIB_PREBUILT_SPACE(instantiation, scalar_t, 2, SBLIB_PREBUILT_RANK_SUM_2, SBLIB_PREBUILT_RANK_SUMS_1, SBLIB_PREBUILT_RANK_SUMS_2) \
+	SBLIB_PREBUILT_SPACE(instantiation, scalar_t, 3, SBLIB_PREBUILT_RANK_SUM_3, SBLIB_PREBUILT_RANK_SUMS_2, SBLIB_PREBUILT_RANK_SUMS_3) \
+	SBLIB_PREBUILT_SPACE(instantiation, scalar_t, 4, SBLIB_PREBUILT_RANK_SUM_4, SBLIB_PREBUILT_RANK_SUMS_3, SBLIB_PREBUILT_RANK_SUMS_4) \
+	SBLIB_PREBUILT_SPACE(instantiation, scalar_t, 5, SBLIB_PREBUILT_RANK_SUM_5, SBLIB_PREBUILT_RANK_SUMS_4, SBLIB_PREBUILT_RANK_SUMS_5)
+
+#if !defined( SBLIB_BUILDING_PREBUILT_ALGEBRA )
+SBLIB_PREBUILT_ALGEBRA(extern template, float)
+SBLIB_PREBUILT_ALGEBRA(extern template, double)
+#endif
+} // namespace SBLib::Mathematics
+namespace SBLib { using namespace Mathematics; }
@@ -0,0 +1,165 @@
+#pragma once
+#include <Mathematics/determinant.h>
+#include <Mathematics/expansion.h>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace SBLib::Mathematics
+{
+//
+// Adaptive exact geometric predicates
+// orient and insphere are signs of n-fold wedge products of edge vectors. They are first evaluated with the floating point
+// determinant kernels and accepted as soon as the result exceeds a static error bound. Only inputs failing that filter
+// (near-degenerate or exactly degenerate configurations) are evaluated again, exactly, with expansion arithmetic.
+// Coordinates must be finite floats or doubles, both being exactly representable in the expansions' double components.
+//
+// Error bound : a sum of products evaluated with at most `depth` roundings on any path from an input to the result is off
+// by at most gamma(depth) = depth * u / (1 - depth * u) times the same sum on absolute values (u = epsilon / 2), which is in
+// turn bounded by the product of the rows 1-norms. The coefficient below leaves room for the rounding of the bound itself
+// and the last term accounts for gradual underflow of the products.
+// The determinant kernels round at most D * (D + 1) / 2 times on any path for a D x D matrix of edges (edge difference
+// included) and the lifted |e|^2 column of insphere adds another d roundings in dimension d.
+//
+template<typename scalar_t, size_t space_mask, size_t rank_size>
+inline scalar_t norm_1(const multivector_t<scalar_t, space_mask, rank_size>& u)
+{
+	scalar_t result = std::abs(u.components[0]);
+	for (size_t index = 1; index < u.dimension_size; ++index)
+		result += std::abs(u.components[index]);
+	return result;
+}
+
+template<size_t depth, typename scalar_t, size_t space_mask, typename... vector_types>
+inline int filtered_determinant_sign(const vector_t<scalar_t, space_mask>& row, const vector_types&... rows)
+{
+	enum : size_t
+	{
+		row_count     = sizeof...(rows) + 1,
+		product_count = row_count << row_count,
+	};
+	const scalar_t value = determinant(row, rows...);
+	const scalar_t coefficient = scalar_t(depth + row_count * row_count + 2) * std::numeric_limits<scalar_t>::epsilon();
+	const scalar_t bound = coefficient * (norm_1(row) * ... * norm_1(rows)) + scalar_t(product_count) * std::numeric_limits<scalar_t>::denorm_min();
+	return (value > bound) ? +1 : (value < -bound) ? -1 : 0; // 0 : undecided
+}
+
+template<typename scalar_t, size_t space_mask>
+inline auto exact_difference(const vector_t<scalar_t, space_mask>& p, const vector_t<scalar_t, space_mask>& q)
+{
+	using exact_vector_t = vector_t<expansion_t, space_mask>;
+	exact_vector_t result(exact_vector_t::UNINITIALIZED);
+	for (size_t index = 0; index < result.dimension_size; ++index)
+		result.components[index] = expansion_t::difference(p.components[index], q.components[index]);
+	return std::move(result);
+}
+
+//
+// lift
+// Paraboloid lifting e -> (e, |e|^2) onto one extra basis vector, placed after the highest bit of space_mask.
+//
+template<typename scalar_t, size_t space_mask>
+inline auto lift(const vector_t<scalar_t, space_mask>& u)
+{
+	enum : size_t
+	{
+		dimension_size = SBLib::bit_traits<space_mask>::population_count,
+		last_bit       = SBLib::bit_traits<space_mask>::get_bit<dimension_size - 1>(),
+		lifted_bit     = (last_bit << 1),
+	};
+	static_assert(lifted_bit != 0, "No basis vector left to lift onto.");
+	using lifted_vector_t = vector_t<scalar_t, (space_mask | lifted_bit)>;
+	lifted_vector_t result(lifted_vector_t::UNINITIALIZED);
+	scalar_t norm_squared = u.components[0] * u.components[0];
+	result.components[0] = u.components[0];
+	for (size_t index = 1; index < dimension_size; ++index)
+	{
+		norm_squared += u.components[index] * u.components[index];
+		result.components[index] = u.components[index];
+	}
+	result.components[dimension_size] = norm_squared;
+	return std::move(result);
+}
+
+
+//
+// orient
+// Exact sign of (p1 - p0) ^ ... ^ (pn - p0) relative to the pseudoscalar : same convention as orientation, without round-off errors.
+//
+template<typename scalar_t, size_t space_mask, typename... vector_types>
+inline int orient(const vector_t<scalar_t, space_mask>& p0, const vector_types&... points)
+{
+	static_assert(std::is_same_v<scalar_t, float> || std::is_same_v<scalar_t, double>, "Adaptive predicates require float or double coordinates.");
+	enum : size_t
+	{
+		dimension_size = SBLib::bit_traits<space_mask>::population_count,
+		depth          = dimension_size * (dimension_size + 1) / 2,
+	};
+	static_assert(sizeof...(points) == dimension_size, "orient requires dimension + 1 points.");
+
+	const int sign = filtered_determinant_sign<depth>((points - p0)...);
+	if (sign != 0)
+		return sign;
+	return determinant(exact_difference(points, p0)...).sign();
+}
+
+
+//
+// insphere
+// Sign of the query point q relative to the sphere through p0, ..., pn : +1 inside, -1 outside and 0 on the sphere
+// when (p0, ..., pn) is positively oriented (c.f., orient). Signs are reversed for negatively oriented simplices.
+// It is the sign of the wedge of the lifted edges (p0 - q, |p0 - q|^2) ^ ... ^ (pn - q, |pn - q|^2), up to a dimension parity.
+//
+template<typename scalar_t, size_t space_mask, size_t point_count, size_t... indices>
+inline int insphere_helper(const vector_t<scalar_t, space_mask> (&points)[point_count], std::index_sequence<indices...>)
+{
+	enum : size_t
+	{
+		dimension_size = SBLib::bit_traits<space_mask>::population_count,
+		lifted_size    = dimension_size + 1,
+		depth          = lifted_size * (lifted_size + 1) / 2 + dimension_size,
+	};
+	enum : int { parity = (dimension_size & 1) ? -1 : +1, };
+	static_assert(point_count == dimension_size + 2, "insphere requires dimension + 1 points and the query point.");
+	const auto& query = points[point_count - 1];
+
+	const int sign = filtered_determinant_sign<depth>(lift(points[indices] - query)...);
+	if (sign != 0)
+		return parity * sign;
+	return parity * determinant(lift(exact_difference(points[indices], query))...).sign();
+}
+template<typename scalar_t, size_t space_mask, typename... vector_types>
+inline int insphere(const vector_t<scalar_t, space_mask>& p0, const vector_types&... points)
+{
+	static_assert(std::is_same_v<scalar_t, float> || std::is_same_v<scalar_t, double>, "Adaptive predicates require float or double coordinates.");
+	const vector_t<scalar_t, space_mask> all_points[] = { p0, points... };
+	return insphere_helper(all_points, std::make_index_sequence<sizeof...(points)>());
+}
+template<typename scalar_t, size_t space_mask>
+inline int incircle(const vector_t<scalar_t, space_mask>& a, const vector_t<scalar_t, space_mask>& b, const vector_t<scalar_t, space_mask>& c, const vector_t<scalar_t, space_mask>& query)
+{
+	static_assert(SBLib::bit_traits<space_mask>::population_count == 2, "incircle is the 2-dimensional insphere.");
+	return insphere(a, b, c, query);
+}
+
+
+//
+// Batch versions over structure-of-arrays streams.
+//
+template<typename scalar_t, size_t space_mask, typename... vector_soa_types>
+inline void orient(int* result, const vector_soa_t<scalar_t, space_mask>& p0, const vector_soa_types&... points)
+{
+	const size_t count = p0.size();
+	for (size_t index = 0; index < count; ++index)
+		result[index] = orient(p0.load(index), points.load(index)...);
+}
+template<typename scalar_t, size_t space_mask, typename... vector_soa_types>
+inline void insphere(int* result, const vector_soa_t<scalar_t, space_mask>& p0, const vector_soa_types&... points)
+{
+	const size_t count = p0.size();
+	for (size_t index = 0; index < count; ++index)
+		result[index] = insphere(p0.load(index), points.load(index)...);
+}
+} // namespace SBLib::Mathematics
+namespace SBLib { using namespace Mathematics; }
@@ -0,0 +1,177 @@
+#pragma once
+#include <Mathematics/approximation.h>
+#include <Mathematics/blade.h>
+#include <Mathematics/exterior_algebra.h>
+#include <Mathematics/multivector_soa.h>
+#include <Mathematics/spinor.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace SBLib::Mathematics
+{
+//
+// rotor_t
+// Even versor of a Euclidian space : scalar + bivector in 2-D and 3-D, scalar + bivector + pseudoscalar in 4-D.
+//
+template<typename scalar_t, size_t space_mask>
+using rotor_t = typename versor_from_grade_mask<scalar_t, space_mask, spinor_traits<SBLib::bit_traits<space_mask>::population_count>::grade_mask>::type;
+
+struct rotor_exponential_helper
+{
+	template<typename scalar_t, size_t space_mask>
+	static scalar_t get_norm_squared(const multivector_t<scalar_t, space_mask, 2>& B)
+	{
+		scalar_t norm2 = scalar_t(0);
+		for (size_t index = 0; index < multivector_t<scalar_t, space_mask, 2>::dimension_size; ++index)
+			norm2 += B.components[index] * B.components[index];
+		return norm2;
+	}
+	// sin(angle) / angle, with angle >= 0
+	template<size_t accuracy, typename scalar_t>
+	static void get_cos_sinc(const scalar_t& angle, scalar_t& cosine, scalar_t& sinc)
+	{
+		scalar_t sine;
+		approximate_sin_cos<accuracy>(angle, sine, cosine);
+		sinc = (angle > scalar_t(0)) ? sine / angle : scalar_t(1);
+	}
+	// angle / sin(angle) for sin(angle) = sine >= 0 and cos(angle) = cosine
+	template<size_t accuracy, typename scalar_t>
+	static scalar_t get_inverse_sinc(const scalar_t& sine, const scalar_t& cosine)
+	{
+		const scalar_t angle = approximate_atan2<accuracy>(sine, cosine);
+		return (sine > scalar_t(0)) ? angle / sine : scalar_t(1) / cosine;
+	}
+
+	// blades of B containing first_mask, i.e. e ^ (e . B) for the basis vector e = e_(first_mask)
+	template<size_t first_mask>
+	struct select_blades
+	{
+		template<size_t blade_mask, size_t index>
+		struct do_action
+		{
+			template<typename scalar_t, size_t space_mask>
+			do_action(multivector_t<scalar_t, space_mask, 2>& result, const multivector_t<scalar_t, space_mask, 2>& B)
+			{
+				result.components[index] = ((blade_mask & first_mask) != 0) ? B.components[index] : scalar_t(0);
+			}
+		};
+	};
+};
+
+
+//
+// rotor_exp / rotor_log
+// Closed forms of the exponential of a bivector B and of its inverse on normalized rotors, with the polynomial
+// approximations of approximation.h. In 2-D and 3-D, B is simple and B^2 = -|B|^2, so that with a = |B| :
+//	exp(B) = cos(a) + sin(a) / a B
+// In 4-D, B = B1 + B2 is the sum of two commuting simple bivectors in orthogonal planes (c.f., invariant_decomposition) and
+// the pseudoscalar I (I^2 = 1) maps the self-dual (I B+ = B+) and anti-self-dual (I B- = -B-) parts B+- = (B +- I B) / 2
+// onto themselves. B^2 = -|B|^2 + m I with m I = B ^ B, and the invariants a+- = |B1| +- |B2| = sqrt(|B|^2 -+ m) give
+//	exp(B) = cos(a+) (1 + I) / 2 + cos(a-) (1 - I) / 2 + sin(a+) / a+ B+ + sin(a-) / a- B-
+// which never divides by |B1|^2 - |B2|^2 (isoclinic rotations are not special cases). rotor_log inverts each half with
+// a+- = atan2(sqrt(2) |R+-|, s +- p) for the scalar s, pseudoscalar p and bivector parts R+- of the rotor.
+// Angles of the log are principal (rotation angles in [0, 2 pi)).
+//
+template<size_t accuracy = DEFAULT_ACCURACY, typename scalar_t, size_t space_mask>
+inline rotor_t<scalar_t, space_mask> rotor_exp(const multivector_t<scalar_t, space_mask, 2>& B)
+{
+	enum : size_t { dimension_size = SBLib::bit_traits<space_mask>::population_count, };
+	static_assert(dimension_size >= 2 && dimension_size <= 4, "Closed-form rotor exponential is only available in 2-D, 3-D and 4-D.");
+	using helper = rotor_exponential_helper;
+	const scalar_t norm2 = helper::get_norm_squared(B);
+	if constexpr (dimension_size < 4)
+	{
+		scalar_t cosine, sinc;
+		helper::get_cos_sinc<accuracy>(std::sqrt(norm2), cosine, sinc);
+		return rotor_t<scalar_t, space_mask>{ multivector_t<scalar_t, space_mask, 0>{ scalar_t(cosine) }, B * sinc };
+	}
+	else
+	{
+		const scalar_t m = (B ^ B).components[0];
+		const auto IB = pseudoscalar_t<space_mask>() * B;
+		scalar_t cosine_plus, sinc_plus, cosine_minus, sinc_minus;
+		helper::get_cos_sinc<accuracy>(std::sqrt(std::max(norm2 - m, scalar_t(0))), cosine_plus, sinc_plus);
+		helper::get_cos_sinc<accuracy>(std::sqrt(std::max(norm2 + m, scalar_t(0))), cosine_minus, sinc_minus);
+		return rotor_t<scalar_t, space_mask>{
+			multivector_t<scalar_t, space_mask, 0>{ scalar_t(0.5) * (cosine_plus + cosine_minus) },
+			B * (scalar_t(0.5) * (sinc_plus + sinc_minus)) + IB * (scalar_t(0.5) * (sinc_plus - sinc_minus)),
+			multivector_t<scalar_t, space_mask, 4>{ scalar_t(0.5) * (cosine_plus - cosine_minus) } };
+	}
+}
+template<size_t accuracy = DEFAULT_ACCURACY, typename scalar_t, size_t space_mask>
+inline multivector_t<scalar_t, space_mask, 2> rotor_log(const versor_t<scalar_t, space_mask, 0, 2>& R)
+{
+	static_assert(SBLib::bit_traits<space_mask>::population_count >= 2 && SBLib::bit_traits<space_mask>::population_count <= 3, "Rotors of 4-D spaces have a pseudoscalar part.");
+	const auto& B = std::get<1>(R);
+	const scalar_t sine = std::sqrt(rotor_exponential_helper::get_norm_squared(B));
+	return B * rotor_exponential_helper::get_inverse_sinc<accuracy>(sine, std::get<0>(R).components[0]);
+}
+template<size_t accuracy = DEFAULT_ACCURACY, typename scalar_t, size_t space_mask>
+inline multivector_t<scalar_t, space_mask, 2> rotor_log(const versor_t<scalar_t, space_mask, 0, 2, 4>& R)
+{
+	static_assert(SBLib::bit_traits<space_mask>::population_count == 4, "Closed-form rotor logarithm is only available in 2-D, 3-D and 4-D.");
+	using helper = rotor_exponential_helper;
+	const scalar_t  s = std::get<0>(R).components[0];
+	const auto&     B = std::get<1>(R);
+	const scalar_t& p = std::get<2>(R).components[0];
+	const auto IB = pseudoscalar_t<space_mask>() * B;
+	const auto B_plus  = (B + IB) * scalar_t(0.5);
+	const auto B_minus = (B - IB) * scalar_t(0.5);
+	const scalar_t sine_plus  = std::sqrt(scalar_t(2) * helper::get_norm_squared(B_plus));
+	const scalar_t sine_minus = std::sqrt(scalar_t(2) * helper::get_norm_squared(B_minus));
+	return B_plus * helper::get_inverse_sinc<accuracy>(sine_plus, s + p) + B_minus * helper::get_inverse_sinc<accuracy>(sine_minus, s - p);
+}
+
+//
+// invariant_decomposition
+// Splits a 4-D bivector into commuting simple bivectors B = B1 + B2 (B1 B2 = B2 B1 = B1 ^ B2), with |B1| >= |B2|.
+// With d = sqrt(|B|^4 - m^2) = |B1|^2 - |B2|^2 :
+//	B1 = ((|B|^2 + d) B + m I B) / (2 d)
+// Isoclinic bivectors (d ~ 0) have infinitely many decompositions and any plane containing a basis vector e and its image
+// is invariant, so B1 = e ^ (e . B) is taken for the first basis vector of the space.
+//
+template<typename scalar_t, size_t space_mask>
+inline std::pair<multivector_t<scalar_t, space_mask, 2>, multivector_t<scalar_t, space_mask, 2>> invariant_decomposition(const multivector_t<scalar_t, space_mask, 2>& B)
+{
+	static_assert(SBLib::bit_traits<space_mask>::population_count == 4, "Invariant decomposition is only implemented for 4-D bivectors.");
+	using helper = rotor_exponential_helper;
+	const scalar_t norm2 = helper::get_norm_squared(B);
+	const scalar_t m = (B ^ B).components[0];
+	const scalar_t d = std::sqrt(std::max(norm2 * norm2 - m * m, scalar_t(0)));
+
+	multivector_t<scalar_t, space_mask, 2> B1(multivector_t<scalar_t, space_mask, 2>::UNINITIALIZED);
+	if (d > std::sqrt(std::numeric_limits<scalar_t>::epsilon()) * norm2)
+		B1 = (B * (norm2 + d) + (pseudoscalar_t<space_mask>() * B) * m) * (scalar_t(0.5) / d);
+	else
+		SBLib::for_each_combination< SBLib::select_combinations<space_mask, 2> >::iterate<helper::select_blades<(space_mask & (~space_mask + 1))>::do_action>(B1, B);
+	return { B1, B - B1 };
+}
+
+
+//
+// Batch versions over structure-of-arrays streams
+// Every step of the closed forms is a select, so that the loops vectorize.
+//
+template<size_t accuracy = DEFAULT_ACCURACY, typename scalar_t, size_t space_mask, size_t... ranks>
+inline void rotor_exp(const versor_soa_t<scalar_t, space_mask, ranks...>& result, const multivector_soa_t<scalar_t, space_mask, 2>& bivectors)
+{
+	static_assert(std::is_same_v<versor_t<scalar_t, space_mask, ranks...>, rotor_t<scalar_t, space_mask>>, "Result grades must match the grades of the rotor.");
+	const size_t count = bivectors.size();
+	for (size_t index = 0; index < count; ++index)
+	{
+		const rotor_t<scalar_t, space_mask> rotor = rotor_exp<accuracy>(bivectors.load(index));
+		(std::get<multivector_soa_t<scalar_t, space_mask, ranks>>(result).store(index, std::get<multivector_t<scalar_t, space_mask, ranks>>(rotor)), ...);
+	}
+}
+template<size_t accuracy = DEFAULT_ACCURACY, typename scalar_t, size_t space_mask, size_t... ranks>
+inline void rotor_log(const multivector_soa_t<scalar_t, space_mask, 2>& result, const versor_soa_t<scalar_t, space_mask, ranks...>& rotors)
+{
+	static_assert(std::is_same_v<versor_t<scalar_t, space_mask, ranks...>, rotor_t<scalar_t, space_mask>>, "Rotor grades must match the dimension of the space.");
+	const size_t count = result.size();
+	for (size_t index = 0; index < count; ++index)
+		result.store(index, rotor_log<accuracy>(versor_t<scalar_t, space_mask, ranks...>(std::get<multivector_soa_t<scalar_t, space_mask, ranks>>(rotors).load(index)...)));
+}
+} // namespace SBLib::Mathematics
+namespace SBLib { using namespace Mathematics; }
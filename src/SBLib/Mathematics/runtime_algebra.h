@@ -0,0 +1,491 @@
+#pragma once
+#include <Mathematics/multivector.h>
+#include <Traits/bit_traits.h>
+#include <Traits/clifford_traits.h>
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif // #if defined(__AVX2__)
+
+namespace SBLib::Mathematics
+{
+//
+// rank_blade / unrank_blade
+// Component index of a blade of space_mask within its grade, and back, in O(rank) steps. The blade is first compacted to
+// the low bits (extract_bits / deposit_bits), then the recursion of combination_ordering_builder is unrolled from the
+// highest dimension down : every step either removes the highest bit (constructed blades) or moves to the conjugate rank,
+// composing the index with an affine map, and the dimensions which leave the index unchanged are skipped at once (a bit scan
+// when ranking, a binary search over the binomial table when unranking).
+//
+struct runtime_combination_helper
+{
+	static size_t get_full_mask(size_t dimension_size)
+	{
+		return (dimension_size < 8 * sizeof(size_t)) ? (size_t(1) << dimension_size) - 1 : ~size_t(0);
+	}
+	static size_t get_binomial_coefficient(size_t dimension_size, size_t rank_size)
+	{
+		return size_t(binomial_coefficient_table::get(dimension_size, rank_size));
+	}
+	static size_t extract_bits(size_t blade, size_t space_mask)
+	{
+		if ((space_mask & (space_mask + 1)) == 0)
+			return blade;
+		return SBLib::extract_bits(blade, space_mask);
+	}
+	static size_t deposit_bits(size_t bits, size_t space_mask)
+	{
+		if ((space_mask & (space_mask + 1)) == 0)
+			return bits;
+		return SBLib::deposit_bits(bits, space_mask);
+	}
+
+	// index = offset + index' (or offset - index' once reversed)
+	struct affine_index
+	{
+		size_t offset      = 0;
+		bool   is_reversed = false;
+
+		void compose(size_t value, bool is_reversing)
+		{
+			offset = is_reversed ? offset - value : offset + value;
+			is_reversed = (is_reversed != is_reversing);
+		}
+		size_t get(size_t index) const { return is_reversed ? offset - index : offset + index; }
+	};
+};
+
+inline size_t rank_blade(size_t space_mask, size_t blade)
+{
+	using helper = runtime_combination_helper;
+	assert((blade & ~space_mask) == 0);
+	size_t dimension_size = SBLib::count_bits(space_mask);
+	size_t bits           = helper::extract_bits(blade, space_mask);
+	size_t rank_size      = SBLib::count_bits(bits);
+	helper::affine_index index;
+	while (rank_size > 1)
+	{
+		if (2 * rank_size > dimension_size)
+		{
+			bits ^= helper::get_full_mask(dimension_size);
+			rank_size = dimension_size - rank_size;
+			continue;
+		}
+		if (2 * rank_size == dimension_size)
+		{
+			const size_t half_count = helper::get_binomial_coefficient(dimension_size - 1, rank_size);
+			if ((bits >> (dimension_size - 1)) != 0)
+			{
+				index.compose(2 * half_count - 1, true);
+				bits ^= helper::get_full_mask(dimension_size);
+			}
+			index.compose(half_count - 1, true);
+			--dimension_size;
+			continue;
+		}
+		dimension_size = std::max(SBLib::get_bit_width(bits), 2 * rank_size);
+		if (2 * rank_size == dimension_size)
+			continue;
+		index.compose(helper::get_binomial_coefficient(dimension_size - 1, rank_size), false);
+		bits ^= size_t(1) << (dimension_size - 1);
+		--dimension_size;
+		--rank_size;
+	}
+	return index.get((rank_size == 0) ? 0 : SBLib::count_trailing_zeros(bits));
+}
+
+inline size_t unrank_blade(size_t space_mask, size_t rank_size, size_t index)
+{
+	using helper = runtime_combination_helper;
+	size_t dimension_size = SBLib::count_bits(space_mask);
+	assert(rank_size <= dimension_size && index < helper::get_binomial_coefficient(dimension_size, rank_size));
+	size_t bits = 0;
+	while (rank_size > 1)
+	{
+		if (2 * rank_size > dimension_size)
+		{
+			bits ^= helper::get_full_mask(dimension_size);
+			rank_size = dimension_size - rank_size;
+			continue;
+		}
+		if (2 * rank_size == dimension_size)
+		{
+			const size_t half_count = helper::get_binomial_coefficient(dimension_size - 1, rank_size);
+			if (index >= half_count)
+			{
+				bits ^= helper::get_full_mask(dimension_size);
+				index = 2 * half_count - 1 - index;
+			}
+			index = half_count - 1 - index;
+			--dimension_size;
+			continue;
+		}
+		// smallest dimension in [2 rank, dimension] which still holds index
+		size_t lower = 2 * rank_size;
+		while (lower < dimension_size)
+		{
+			const size_t middle = (lower + dimension_size) / 2;
+			if (index < helper::get_binomial_coefficient(middle, rank_size))
+				dimension_size = middle;
+			else
+				lower = middle + 1;
+		}
+		if (2 * rank_size == dimension_size)
+			continue;
+		index -= helper::get_binomial_coefficient(dimension_size - 1, rank_size);
+		bits ^= size_t(1) << (dimension_size - 1);
+		--dimension_size;
+		--rank_size;
+	}
+	if (rank_size == 1)
+		bits ^= size_t(1) << index;
+	return helper::deposit_bits(bits, space_mask);
+}
+
+inline void rank_blades(size_t* result, size_t space_mask, const size_t* blades, size_t count)
+{
+	for (size_t index = 0; index < count; ++index)
+		result[index] = rank_blade(space_mask, blades[index]);
+}
+inline void unrank_blades(size_t* result, size_t space_mask, size_t rank_size, const size_t* indices, size_t count)
+{
+	for (size_t index = 0; index < count; ++index)
+		result[index] = unrank_blade(space_mask, rank_size, indices[index]);
+}
+
+//
+// Runtime combinations
+// Runtime counterpart of combinations<space_mask>::select<rank_size>::get<index>(), giving the same Hodge-natural ordering
+// so that runtime multivectors and multivector_t share their component layout grade by grade.
+//
+inline size_t get_runtime_combination(size_t space_mask, size_t rank_size, size_t index)
+{
+	return unrank_blade(space_mask, rank_size, index);
+}
+
+
+//
+// runtime_algebra_tables
+// Layout and product tables of the Clifford algebra of a dimension and signature chosen at run time.
+// Components of a runtime multivector are stored grade after grade, each grade in combinations order (c.f., graded_traits).
+// Products are output-stationary : result component r sums sign(r, i) u[i] v[second_index(r, i)] over every component i of u,
+// which is a contiguous load of u and a gather of v. Tables are only built up to max_table_dimension : second_index,
+// geometric_sign and exterior_sign hold 4 bytes per pair of components, i.e., 12 MB at dimension 10. Above that, indices and
+// signs are computed on the fly from the blade masks.
+//
+// Tables are built once per (dimension, negative_mask, null_mask) on first use and cached for the lifetime of the process :
+// lookups walk an immutable list published with release/acquire atomics, so only the first build of a signature takes a lock.
+//
+struct runtime_algebra_tables
+{
+	enum : size_t
+	{
+		max_dimension       = 24,
+		max_table_dimension = 10,
+	};
+
+	size_t dimension_size;
+	size_t negative_mask;
+	size_t null_mask;
+	size_t component_count;
+	std::vector<size_t>   grade_offsets;     // dimension_size + 2 entries
+	std::vector<size_t>   blades;            // component index -> blade mask
+	std::vector<uint32_t> components_index;  // blade mask -> component index
+	std::vector<uint32_t> hodge_index;
+	std::vector<float>    hodge_sign;
+	std::vector<float>    reversion_sign;
+	std::vector<uint32_t> second_index;      // component_count^2 entries, empty above max_table_dimension
+	std::vector<float>    geometric_sign;
+	std::vector<float>    exterior_sign;
+
+	bool has_product_tables() const { return !second_index.empty(); }
+
+	int get_geometric_sign(size_t first_mask, size_t second_mask) const
+	{
+		const size_t common = (first_mask & second_mask);
+		if ((common & null_mask) != 0)
+			return 0;
+		const size_t parity = SBLib::get_permutation_parity(first_mask, second_mask) ^ (SBLib::count_bits(common & negative_mask) & 1);
+		return parity != 0 ? -1 : +1;
+	}
+	int get_exterior_sign(size_t first_mask, size_t second_mask) const
+	{
+		return SBLib::get_alternating_sign(first_mask, second_mask);
+	}
+
+	static const runtime_algebra_tables& get(size_t dimension_size, size_t negative_mask = 0, size_t null_mask = 0);
+
+private:
+	struct cache_entry;
+	runtime_algebra_tables(size_t dimension_size, size_t negative_mask, size_t null_mask)
+		: dimension_size(dimension_size), negative_mask(negative_mask), null_mask(null_mask), component_count(size_t(1) << dimension_size)
+	{
+		assert(dimension_size <= max_dimension && (negative_mask & null_mask) == 0);
+		const size_t space_mask = component_count - 1;
+
+		grade_offsets.resize(dimension_size + 2);
+		blades.reserve(component_count);
+		for (size_t rank = 0; rank <= dimension_size; ++rank)
+		{
+			grade_offsets[rank] = blades.size();
+			const size_t count = runtime_combination_helper::get_binomial_coefficient(dimension_size, rank);
+			for (size_t index = 0; index < count; ++index)
+				blades.push_back(get_runtime_combination(space_mask, rank, index));
+		}
+		grade_offsets[dimension_size + 1] = component_count;
+
+		components_index.resize(component_count);
+		for (size_t index = 0; index < component_count; ++index)
+			components_index[blades[index]] = uint32_t(index);
+
+		hodge_index.resize(component_count);
+		hodge_sign.resize(component_count);
+		reversion_sign.resize(component_count);
+		for (size_t index = 0; index < component_count; ++index)
+		{
+			// c.f., hodge_conjugacy_traits and reversion_conjugacy_traits
+			const size_t blade = blades[index], complement = (space_mask & ~blade);
+			const bool is_null = (blade & null_mask) != 0;
+			const bool is_negative = (SBLib::get_population_count(blade & negative_mask) & 1) != 0;
+			hodge_index[index] = components_index[complement];
+			hodge_sign[index]  = is_null ? 0.0f : float(SBLib::get_alternating_sign(blade, complement) * (is_negative ? -1 : +1));
+			reversion_sign[index] = (SBLib::get_population_count(blade) & 2) != 0 ? -1.0f : +1.0f;
+		}
+
+		if (dimension_size <= max_table_dimension)
+		{
+			second_index.resize(component_count * component_count);
+			geometric_sign.resize(component_count * component_count);
+			exterior_sign.resize(component_count * component_count);
+			std::vector<size_t> second_blades(component_count);
+			for (size_t result = 0; result < component_count; ++result)
+			{
+				const size_t row = result * component_count;
+				for (size_t first = 0; first < component_count; ++first)
+				{
+					second_blades[first]      = (blades[result] ^ blades[first]);
+					second_index[row + first] = components_index[second_blades[first]];
+				}
+				// c.f., get_geometric_sign and get_exterior_sign
+				SBLib::get_blade_signs(geometric_sign.data() + row, blades.data(), second_blades.data(), component_count, null_mask, negative_mask);
+				SBLib::get_blade_signs(exterior_sign.data() + row, blades.data(), second_blades.data(), component_count, ~size_t(0));
+			}
+		}
+	}
+};
+
+struct runtime_algebra_tables::cache_entry
+{
+	runtime_algebra_tables tables;
+	const cache_entry*     next;
+};
+inline const runtime_algebra_tables& runtime_algebra_tables::get(size_t dimension_size, size_t negative_mask, size_t null_mask)
+{
+	// entries are never released : references stay valid for the lifetime of the process
+	static std::atomic<const cache_entry*> cache_head{ nullptr };
+	static std::mutex build_mutex;
+	auto find = [&](const cache_entry* entry) -> const runtime_algebra_tables*
+	{
+		for (; entry != nullptr; entry = entry->next)
+			if (entry->tables.dimension_size == dimension_size && entry->tables.negative_mask == negative_mask && entry->tables.null_mask == null_mask)
+				return &entry->tables;
+		return nullptr;
+	};
+	if (const runtime_algebra_tables* tables = find(cache_head.load(std::memory_order_acquire)))
+		return *tables;
+
+	std::lock_guard<std::mutex> lock(build_mutex);
+	const cache_entry* head = cache_head.load(std::memory_order_acquire);
+	if (const runtime_algebra_tables* tables = find(head))
+		return *tables;
+	const cache_entry* entry = new cache_entry{ runtime_algebra_tables(dimension_size, negative_mask, null_mask), head };
+	cache_head.store(entry, std::memory_order_release);
+	return entry->tables;
+}
+
+
+//
+// Product kernels
+// Tabled kernels walk one row of (second_index, sign) per result component; the AVX2 version gathers 8 components of v at once.
+// Untabled kernels recompute indices and signs from the blade masks and skip the zero components of u.
+//
+template<typename scalar_t>
+inline void runtime_product_kernel(scalar_t* result, const scalar_t* u, const scalar_t* v, const uint32_t* second_index, const float* sign, size_t count)
+{
+	for (size_t row = 0; row < count; ++row, second_index += count, sign += count)
+	{
+		scalar_t sum = scalar_t(0);
+		for (size_t first = 0; first < count; ++first)
+			sum += scalar_t(sign[first]) * u[first] * v[second_index[first]];
+		result[row] = sum;
+	}
+}
+#if defined(__AVX2__)
+inline void runtime_product_kernel(float* result, const float* u, const float* v, const uint32_t* second_index, const float* sign, size_t count)
+{
+	for (size_t row = 0; row < count; ++row, second_index += count, sign += count)
+	{
+		__m256 sums = _mm256_setzero_ps();
+		size_t first = 0;
+		for (; first + 8 <= count; first += 8)
+		{
+			const __m256i indices = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(second_index + first));
+			const __m256 terms = _mm256_mul_ps(_mm256_loadu_ps(sign + first), _mm256_loadu_ps(u + first));
+			sums = _mm256_add_ps(sums, _mm256_mul_ps(terms, _mm256_i32gather_ps(v, indices, 4)));
+		}
+		const __m128 half_sums = _mm_add_ps(_mm256_castps256_ps128(sums), _mm256_extractf128_ps(sums, 1));
+		const __m128 pair_sums = _mm_add_ps(half_sums, _mm_movehl_ps(half_sums, half_sums));
+		float sum = _mm_cvtss_f32(_mm_add_ss(pair_sums, _mm_shuffle_ps(pair_sums, pair_sums, 1)));
+		for (; first < count; ++first)
+			sum += sign[first] * u[first] * v[second_index[first]];
+		result[row] = sum;
+	}
+}
+#endif // #if defined(__AVX2__)
+
+template<bool is_exterior, typename scalar_t>
+inline void runtime_untabled_product_kernel(scalar_t* result, const scalar_t* u, const scalar_t* v, const runtime_algebra_tables& tables)
+{
+	const size_t count = tables.component_count;
+	for (size_t row = 0; row < count; ++row)
+		result[row] = scalar_t(0);
+	for (size_t first = 0; first < count; ++first)
+	{
+		if (u[first] == scalar_t(0))
+			continue;
+		const size_t first_blade = tables.blades[first];
+		for (size_t second = 0; second < count; ++second)
+		{
+			const size_t second_blade = tables.blades[second];
+			const int sign = is_exterior ? tables.get_exterior_sign(first_blade, second_blade) : tables.get_geometric_sign(first_blade, second_blade);
+			if (sign != 0)
+				result[tables.components_index[first_blade ^ second_blade]] += scalar_t(sign) * u[first] * v[second];
+		}
+	}
+}
+
+
+//
+// runtime_multivector_t
+// Full multivector (every grade) of a runtime algebra.
+//
+template<typename scalar_t>
+struct runtime_multivector_t
+{
+	explicit runtime_multivector_t(const runtime_algebra_tables& tables) : algebra(&tables), components(tables.component_count, scalar_t(0)) {}
+
+	scalar_t& operator [](size_t blade_mask) { return components[algebra->components_index[blade_mask]]; }
+	scalar_t get(size_t blade_mask) const { return components[algebra->components_index[blade_mask]]; }
+
+	// same layout as multivector_t within a grade, for any space_mask of the same dimension
+	template<size_t space_mask, size_t rank_size>
+	void set_part(const multivector_t<scalar_t, space_mask, rank_size>& part)
+	{
+		assert(SBLib::bit_traits<space_mask>::population_count == algebra->dimension_size);
+		const size_t offset = algebra->grade_offsets[rank_size];
+		for (size_t index = 0; index < multivector_t<scalar_t, space_mask, rank_size>::dimension_size; ++index)
+			components[offset + index] = part.components[index];
+	}
+	template<size_t space_mask, size_t rank_size>
+	multivector_t<scalar_t, space_mask, rank_size> get_part() const
+	{
+		assert(SBLib::bit_traits<space_mask>::population_count == algebra->dimension_size);
+		multivector_t<scalar_t, space_mask, rank_size> part(multivector_t<scalar_t, space_mask, rank_size>::UNINITIALIZED);
+		const size_t offset = algebra->grade_offsets[rank_size];
+		for (size_t index = 0; index < multivector_t<scalar_t, space_mask, rank_size>::dimension_size; ++index)
+			part.components[index] = components[offset + index];
+		return std::move(part);
+	}
+
+	const runtime_algebra_tables* algebra;
+	std::vector<scalar_t>         components;
+};
+
+template<typename scalar_t>
+inline auto geometric_product(const runtime_multivector_t<scalar_t>& u, const runtime_multivector_t<scalar_t>& v)
+{
+	assert(u.algebra == v.algebra);
+	const runtime_algebra_tables& tables = *u.algebra;
+	runtime_multivector_t<scalar_t> result(tables);
+	if (tables.has_product_tables())
+		runtime_product_kernel(result.components.data(), u.components.data(), v.components.data(), tables.second_index.data(), tables.geometric_sign.data(), tables.component_count);
+	else
+		runtime_untabled_product_kernel<false>(result.components.data(), u.components.data(), v.components.data(), tables);
+	return std::move(result);
+}
+template<typename scalar_t>
+inline auto wedge_product(const runtime_multivector_t<scalar_t>& u, const runtime_multivector_t<scalar_t>& v)
+{
+	assert(u.algebra == v.algebra);
+	const runtime_algebra_tables& tables = *u.algebra;
+	runtime_multivector_t<scalar_t> result(tables);
+	if (tables.has_product_tables())
+		runtime_product_kernel(result.components.data(), u.components.data(), v.components.data(), tables.second_index.data(), tables.exterior_sign.data(), tables.component_count);
+	else
+		runtime_untabled_product_kernel<true>(result.components.data(), u.components.data(), v.components.data(), tables);
+	return std::move(result);
+}
+template<typename scalar_t>
+inline auto operator *(const runtime_multivector_t<scalar_t>& u, const runtime_multivector_t<scalar_t>& v)
+{
+	return geometric_product(u, v);
+}
+template<typename scalar_t>
+inline auto operator ^(const runtime_multivector_t<scalar_t>& u, const runtime_multivector_t<scalar_t>& v)
+{
+	return wedge_product(u, v);
+}
+
+template<typename scalar_t>
+inline auto hodge_conjugate(const runtime_multivector_t<scalar_t>& u)
+{
+	const runtime_algebra_tables& tables = *u.algebra;
+	runtime_multivector_t<scalar_t> result(tables);
+	for (size_t index = 0; index < tables.component_count; ++index)
+		result.components[tables.hodge_index[index]] = scalar_t(tables.hodge_sign[index]) * u.components[index];
+	return std::move(result);
+}
+template<typename scalar_t>
+inline auto reverse(const runtime_multivector_t<scalar_t>& u)
+{
+	const runtime_algebra_tables& tables = *u.algebra;
+	runtime_multivector_t<scalar_t> result(tables);
+	for (size_t index = 0; index < tables.component_count; ++index)
+		result.components[index] = scalar_t(tables.reversion_sign[index]) * u.components[index];
+	return std::move(result);
+}
+
+template<typename scalar_t>
+inline auto operator +(const runtime_multivector_t<scalar_t>& u, const runtime_multivector_t<scalar_t>& v)
+{
+	assert(u.algebra == v.algebra);
+	runtime_multivector_t<scalar_t> result(u);
+	for (size_t index = 0; index < result.components.size(); ++index)
+		result.components[index] += v.components[index];
+	return std::move(result);
+}
+template<typename scalar_t>
+inline auto operator -(const runtime_multivector_t<scalar_t>& u, const runtime_multivector_t<scalar_t>& v)
+{
+	assert(u.algebra == v.algebra);
+	runtime_multivector_t<scalar_t> result(u);
+	for (size_t index = 0; index < result.components.size(); ++index)
+		result.components[index] -= v.components[index];
+	return std::move(result);
+}
+template<typename scalar_t>
+inline auto operator *(const runtime_multivector_t<scalar_t>& u, const scalar_t& scale)
+{
+	runtime_multivector_t<scalar_t> result(u);
+	for (auto& component : result.components)
+		component *= scale;
+	return std::move(result);
+}
+} // namespace SBLib::Mathematics
+namespace SBLib { using namespace Mathematics; }
@@ -0,0 +1,179 @@
+#pragma once
+#include <Mathematics/geometric_product.h>
+#include <Mathematics/multivector.h>
+#include <Mathematics/multivector_soa.h>
+#include <Mathematics/outermorphism.h>
+#include <Traits/clifford_traits.h>
+
+namespace SBLib::Mathematics
+{
+//
+// sandwich
+// Fused versor application R x R~ restricted to the grade of x (exact for versors, which preserve grades).
+// Expanding both geometric products, the coefficient of e_D in R e_C R~ is
+//	sum over versor blades A, B with A ^ B == C ^ D of sign(A, B) * R[A] * R[B],
+//	sign(A, B) = geometric_sign(A, C) * geometric_sign(A ^ C, B) * reversion_sign(B)
+// where geometric signs include the metric (c.f., geometric_traits), so terms contracting null vectors vanish too.
+// The (A, B) and (B, A) terms are folded at compile time into a single coefficient in { -2, -1, 0, +1, +2 } and the pairs
+// that cancel emit no code at all, so no mixed-grade temporary of R x is ever formed.
+//
+// sandwich gathers each output component e_D directly : for every versor blade A and input blade C, B = A ^ C ^ D and the
+// folded term coefficient * R[A] * R[B] * x[C] is accumulated, so neither the mixed-grade R x nor the matrix below is formed.
+// sandwich_map builds the resulting rank-k matrix (as an outermorphism_t) from the quadratic terms of R only : it is what
+// gets hoisted out of loops applying a single versor to many elements.
+// Note that R is not normalized : the result is scaled by R R~ (that is, |R|^2 in Euclidian space).
+//
+template<typename metric_type, size_t input_mask, size_t output_mask, size_t... versor_ranks>
+struct sandwich_term_helper
+{
+	template<size_t first_mask, size_t loop>
+	struct do_action
+	{
+		template<typename scalar_t, size_t space_mask, typename... factor_t>
+		do_action(scalar_t& result, const versor_t<scalar_t, space_mask, versor_ranks...>& versor, const factor_t&... factor)
+		{
+			enum : size_t
+			{
+				second_mask = (first_mask ^ input_mask ^ output_mask),
+				second_rank = SBLib::bit_traits<second_mask>::population_count,
+				is_folded   = (first_mask <= second_mask) && versor_part_traits<second_rank, versor_ranks...>::has_part,
+			};
+			if constexpr (is_folded)
+			{
+				enum : int
+				{
+					first_sign  = get_sign<first_mask, second_mask>(),
+					second_sign = (first_mask != second_mask) ? get_sign<second_mask, first_mask>() : 0,
+					coefficient = first_sign + second_sign,
+				};
+				if constexpr (coefficient != 0)
+					result += ((scalar_t(coefficient) * (get_versor_component<first_mask>(versor) * get_versor_component<second_mask>(versor))) * ... * factor);
+			}
+		}
+	private:
+		template<size_t first, size_t second>
+		static constexpr int get_sign()
+		{
+			return SBLib::geometric_traits<first, input_mask, SBLib::default_basis_big_endian, metric_type>::sign
+				* SBLib::geometric_traits<(first ^ input_mask), second, SBLib::default_basis_big_endian, metric_type>::sign
+				* SBLib::reversion_conjugacy_traits<second>::sign;
+		}
+	};
+
+	template<typename scalar_t, size_t space_mask>
+	static scalar_t evaluate(const versor_t<scalar_t, space_mask, versor_ranks...>& versor)
+	{
+		scalar_t result = scalar_t(0);
+		(SBLib::for_each_combination< SBLib::select_combinations<space_mask, versor_ranks> >::iterate<do_action>(result, versor), ...);
+		return result;
+	}
+	template<typename scalar_t, size_t space_mask>
+	static void accumulate(scalar_t& result, const versor_t<scalar_t, space_mask, versor_ranks...>& versor, const scalar_t& input)
+	{
+		(SBLib::for_each_combination< SBLib::select_combinations<space_mask, versor_ranks> >::iterate<do_action>(result, versor, input), ...);
+	}
+};
+
+template<typename metric_type, size_t rank_size, size_t... versor_ranks>
+struct sandwich_gather_helper
+{
+	template<size_t output_mask>
+	struct input_helper
+	{
+		template<size_t input_mask, size_t column>
+		struct do_action
+		{
+			template<typename scalar_t, size_t space_mask>
+			do_action(scalar_t& result, const versor_t<scalar_t, space_mask, versor_ranks...>& versor, const multivector_t<scalar_t, space_mask, rank_size>& x)
+			{
+				sandwich_term_helper<metric_type, input_mask, output_mask, versor_ranks...>::accumulate(result, versor, x.components[column]);
+			}
+		};
+	};
+
+	template<size_t output_mask, size_t row>
+	struct do_action
+	{
+		template<typename scalar_t, size_t space_mask>
+		do_action(multivector_t<scalar_t, space_mask, rank_size>& result, const versor_t<scalar_t, space_mask, versor_ranks...>& versor, const multivector_t<scalar_t, space_mask, rank_size>& x)
+		{
+			scalar_t value = scalar_t(0);
+			SBLib::for_each_combination< SBLib::select_combinations<space_mask, rank_size> >::iterate<input_helper<output_mask>::do_action>(value, versor, x);
+			result.components[row] = value;
+		}
+	};
+};
+
+template<typename metric_type, size_t rank_size, size_t... versor_ranks>
+struct sandwich_map_helper
+{
+	template<size_t input_mask>
+	struct row_helper
+	{
+		template<size_t output_mask, size_t row>
+		struct do_action
+		{
+			template<typename scalar_t, size_t space_mask>
+			do_action(multivector_t<scalar_t, space_mask, rank_size>& column, const versor_t<scalar_t, space_mask, versor_ranks...>& versor)
+			{
+				column.components[row] = sandwich_term_helper<metric_type, input_mask, output_mask, versor_ranks...>::evaluate(versor);
+			}
+		};
+	};
+
+	template<size_t input_mask, size_t column>
+	struct do_action
+	{
+		template<typename scalar_t, size_t space_mask>
+		do_action(outermorphism_t<scalar_t, space_mask, rank_size>& result, const versor_t<scalar_t, space_mask, versor_ranks...>& versor)
+		{
+			SBLib::for_each_combination< SBLib::select_combinations<space_mask, rank_size> >::iterate<row_helper<input_mask>::do_action>(result.columns[column], versor);
+		}
+	};
+};
+
+template<size_t rank_size, typename metric_type = SBLib::euclidian_metric, typename scalar_t, size_t space_mask, size_t... versor_ranks>
+inline auto sandwich_map(const versor_t<scalar_t, space_mask, versor_ranks...>& versor)
+{
+	static_assert(rank_size <= SBLib::bit_traits<space_mask>::population_count, "Invalid rank");
+	outermorphism_t<scalar_t, space_mask, rank_size> result;
+	SBLib::for_each_combination< SBLib::select_combinations<space_mask, rank_size> >::iterate<sandwich_map_helper<metric_type, rank_size, versor_ranks...>::do_action>(result, versor);
+	return std::move(result);
+}
+
+template<typename metric_type = SBLib::euclidian_metric, typename scalar_t, size_t space_mask, size_t rank_size, size_t... versor_ranks>
+inline auto sandwich(const versor_t<scalar_t, space_mask, versor_ranks...>& versor, const multivector_t<scalar_t, space_mask, rank_size>& x)
+{
+	multivector_t<scalar_t, space_mask, rank_size> result;
+	SBLib::for_each_combination< SBLib::select_combinations<space_mask, rank_size> >::iterate<sandwich_gather_helper<metric_type, rank_size, versor_ranks...>::do_action>(result, versor, x);
+	return std::move(result);
+}
+
+
+//
+// Batch versions
+// One versor applied to many elements hoists sandwich_map out of the loop (one small matrix-vector product per element);
+// many versors applied to many elements gather each element directly (c.f., sandwich). Both loop bodies are straight-line code.
+//
+template<typename metric_type = SBLib::euclidian_metric, typename scalar_t, size_t space_mask, size_t rank_size, size_t... versor_ranks>
+inline void sandwich(const versor_t<scalar_t, space_mask, versor_ranks...>& versor, multivector_t<scalar_t, space_mask, rank_size>* result, const multivector_t<scalar_t, space_mask, rank_size>* x, size_t count)
+{
+	apply(sandwich_map<rank_size, metric_type>(versor), result, x, count);
+}
+template<typename metric_type = SBLib::euclidian_metric, typename scalar_t, size_t space_mask, size_t rank_size, size_t... versor_ranks>
+inline void sandwich(const multivector_soa_t<scalar_t, space_mask, rank_size>& result, const versor_t<scalar_t, space_mask, versor_ranks...>& versor, const multivector_soa_t<scalar_t, space_mask, rank_size>& x)
+{
+	apply(sandwich_map<rank_size, metric_type>(versor), result, x);
+}
+template<typename metric_type = SBLib::euclidian_metric, typename scalar_t, size_t space_mask, size_t rank_size, size_t... versor_ranks>
+inline void sandwich(const multivector_soa_t<scalar_t, space_mask, rank_size>& result, const versor_soa_t<scalar_t, space_mask, versor_ranks...>& versors, const multivector_soa_t<scalar_t, space_mask, rank_size>& x)
+{
+	const size_t count = x.size();
+	for (size_t index = 0; index < count; ++index)
+	{
+		const versor_t<scalar_t, space_mask, versor_ranks...> versor(std::get<multivector_soa_t<scalar_t, space_mask, versor_ranks>>(versors).load(index)...);
+		result.store(index, sandwich<metric_type>(versor, x.load(index)));
+	}
+}
+} // namespace SBLib::Mathematics
+namespace SBLib { using namespace Mathematics; }
@@ -0,0 +1,296 @@
+#pragma once
+#include <Mathematics/multivector.h>
+#include <Traits/clifford_traits.h>
+#include <algorithm>
+#include <vector>
+
+namespace SBLib::Mathematics
+{
+//
+// sparse_multivector_t
+// Mixed-grade multivector storing only its non-zero blades, as a flat array of (blade_mask, value) terms sorted by blade mask.
+// Blades are only known at run time, so nothing depends on the number of combinations of space_mask : a 64-D algebra
+// (space_mask = ~0) with a few hundred terms of rank 32 is fine where the dense rank 32 multivector_t would need C(64, 32)
+// components.
+// Products use the runtime blade signs of clifford_traits.h (get_geometric_sign, get_alternating_sign) : every pair of terms
+// is emitted into the result, which is then sorted and coalesced (equal blades summed, zeros dropped).
+//
+template<typename scalar_t>
+struct sparse_term_t
+{
+	size_t   blade_mask;
+	scalar_t value;
+};
+
+template<typename scalar_t, size_t space_mask>
+struct sparse_multivector_t
+{
+private:
+	template<size_t blade_mask, size_t index>
+	struct dense_gather_helper
+	{
+		template<size_t rank_size>
+		dense_gather_helper(std::vector<sparse_term_t<scalar_t>>& terms, const multivector_t<scalar_t, space_mask, rank_size>& dense)
+		{
+			const scalar_t value = dense.components[index];
+			if (value != scalar_t(0))
+				terms.push_back({ blade_mask, value });
+		}
+	};
+	template<size_t blade_mask, size_t index>
+	struct dense_scatter_helper
+	{
+		template<size_t rank_size>
+		dense_scatter_helper(multivector_t<scalar_t, space_mask, rank_size>& dense, const sparse_multivector_t& u)
+		{
+			dense.components[index] = u.get(blade_mask);
+		}
+	};
+	static bool is_lower_blade(const sparse_term_t<scalar_t>& term, size_t blade_mask) { return term.blade_mask < blade_mask; }
+
+public:
+	enum : size_t
+	{
+		space_mask = space_mask,
+	};
+	using scalar_type    = scalar_t;
+	using term_type      = sparse_term_t<scalar_t>;
+	using container_type = std::vector<term_type>;
+
+	sparse_multivector_t() : terms() {};
+	sparse_multivector_t(const sparse_multivector_t& v) : terms(v.terms) {};
+	sparse_multivector_t(sparse_multivector_t&& v) : terms(std::move(v.terms)) {};
+	explicit sparse_multivector_t(container_type&& unsorted_terms) : terms(std::move(unsorted_terms)) { coalesce(); };
+	template<size_t rank_size>
+	explicit sparse_multivector_t(const multivector_t<scalar_t, space_mask, rank_size>& dense) : terms()
+	{
+		// combinations order is not blade mask order
+		for_each_combination<select_combinations<space_mask, rank_size>>::iterate<dense_gather_helper>(terms, dense);
+		std::sort(terms.begin(), terms.end(), [](const term_type& first, const term_type& second) { return first.blade_mask < second.blade_mask; });
+	}
+
+	const sparse_multivector_t& operator =(const sparse_multivector_t& v) { terms = v.terms; return *this; };
+	const sparse_multivector_t& operator =(sparse_multivector_t&& v) { terms = std::move(v.terms); return *this; };
+
+	size_t size() const { return terms.size(); }
+
+	scalar_t get(size_t blade_mask) const
+	{
+		const auto term = std::lower_bound(terms.begin(), terms.end(), blade_mask, is_lower_blade);
+		return (term != terms.end() && term->blade_mask == blade_mask) ? term->value : scalar_t(0);
+	}
+	scalar_t& operator [](size_t blade_mask)
+	{
+		const auto term = std::lower_bound(terms.begin(), terms.end(), blade_mask, is_lower_blade);
+		if (term != terms.end() && term->blade_mask == blade_mask)
+			return term->value;
+		return terms.insert(term, { blade_mask, scalar_t(0) })->value;
+	}
+
+	template<size_t rank_size>
+	multivector_t<scalar_t, space_mask, rank_size> to_dense() const
+	{
+		multivector_t<scalar_t, space_mask, rank_size> dense(multivector_t<scalar_t, space_mask, rank_size>::UNINITIALIZED);
+		for_each_combination<select_combinations<space_mask, rank_size>>::iterate<dense_scatter_helper>(dense, *this);
+		return std::move(dense);
+	}
+
+	// sorts terms by blade mask, sums equal blades and drops zeros
+	void coalesce()
+	{
+		std::sort(terms.begin(), terms.end(), [](const term_type& first, const term_type& second) { return first.blade_mask < second.blade_mask; });
+		auto last = terms.begin();
+		for (auto term = terms.begin(); term != terms.end(); )
+		{
+			term_type sum = *term;
+			for (++term; term != terms.end() && term->blade_mask == sum.blade_mask; ++term)
+				sum.value += term->value;
+			if (sum.value != scalar_t(0))
+				*last++ = sum;
+		}
+		terms.erase(last, terms.end());
+	}
+
+	container_type terms;
+};
+
+template<typename scalar_t, size_t space_mask, size_t rank_size>
+inline auto make_sparse(const multivector_t<scalar_t, space_mask, rank_size>& dense)
+{
+	return sparse_multivector_t<scalar_t, space_mask>(dense);
+}
+
+
+//
+// Linear operations
+//
+template<typename scalar_t, size_t space_mask>
+inline auto operator +(const sparse_multivector_t<scalar_t, space_mask>& u, const sparse_multivector_t<scalar_t, space_mask>& v)
+{
+	typename sparse_multivector_t<scalar_t, space_mask>::container_type terms(u.terms);
+	terms.insert(terms.end(), v.terms.begin(), v.terms.end());
+	return sparse_multivector_t<scalar_t, space_mask>(std::move(terms));
+}
+template<typename scalar_t, size_t space_mask>
+inline auto operator -(const sparse_multivector_t<scalar_t, space_mask>& u, const sparse_multivector_t<scalar_t, space_mask>& v)
+{
+	typename sparse_multivector_t<scalar_t, space_mask>::container_type terms(u.terms);
+	for (const auto& term : v.terms)
+		terms.push_back({ term.blade_mask, -term.value });
+	return sparse_multivector_t<scalar_t, space_mask>(std::move(terms));
+}
+template<typename scalar_t, size_t space_mask>
+inline auto operator *(const sparse_multivector_t<scalar_t, space_mask>& u, const scalar_t& scale)
+{
+	sparse_multivector_t<scalar_t, space_mask> result(u);
+	for (auto& term : result.terms)
+		term.value *= scale;
+	if (scale == scalar_t(0))
+		result.terms.clear();
+	return std::move(result);
+}
+template<typename scalar_t, size_t space_mask>
+inline auto operator *(const scalar_t& scale, const sparse_multivector_t<scalar_t, space_mask>& u)
+{
+	return std::move(u * scale);
+}
+
+
+//
+// Products
+// Sparse x sparse products visit every pair of terms. Sparse x dense products visit every term of the sparse operand against
+// the compile-time blades of the dense one, so half of each sign is known at compile time and zero dense components are skipped :
+// the dense blade folds into a zero mask and a parity mask (c.f., get_permutation_parity_mask), leaving one population count.
+//
+template<typename metric_type, bool is_exterior>
+struct sparse_product_traits
+{
+	static int get_sign(size_t first_mask, size_t second_mask)
+	{
+		if constexpr (is_exterior)
+			return SBLib::get_alternating_sign(first_mask, second_mask);
+		else
+			return SBLib::get_geometric_sign<metric_type>(first_mask, second_mask);
+	}
+	template<typename scalar_t>
+	static void emit(std::vector<sparse_term_t<scalar_t>>& terms, size_t first_mask, const scalar_t& first_value, size_t second_mask, const scalar_t& second_value)
+	{
+		const int sign = get_sign(first_mask, second_mask);
+		if (sign > 0)
+			terms.push_back({ first_mask ^ second_mask, first_value * second_value });
+		else if (sign < 0)
+			terms.push_back({ first_mask ^ second_mask, -(first_value * second_value) });
+	}
+	template<typename scalar_t, size_t space_mask>
+	static auto product(const sparse_multivector_t<scalar_t, space_mask>& u, const sparse_multivector_t<scalar_t, space_mask>& v)
+	{
+		typename sparse_multivector_t<scalar_t, space_mask>::container_type terms;
+		terms.reserve(u.size() * v.size());
+		for (const auto& first : u.terms)
+			for (const auto& second : v.terms)
+				emit(terms, first.blade_mask, first.value, second.blade_mask, second.value);
+		return sparse_multivector_t<scalar_t, space_mask>(std::move(terms));
+	}
+
+	template<bool is_dense_first>
+	struct dense_helper
+	{
+		//
+		// dense_sign_traits
+		// The product of blade_mask with a sparse term is zero if the term has a bit of zero_mask, and negative if it has an odd
+		// number of bits of parity_mask (reordering parity, then negative squares of the common vectors).
+		//
+		template<size_t blade_mask>
+		struct dense_sign_traits
+		{
+			enum : size_t
+			{
+				order_mask  = SBLib::get_permutation_parity_mask(blade_mask, is_dense_first),
+				zero_mask   = is_exterior ? blade_mask : (blade_mask & metric_type::null_mask),
+				parity_mask = is_exterior ? order_mask : (order_mask ^ (blade_mask & metric_type::negative_mask)),
+			};
+		};
+
+		template<size_t blade_mask, size_t index>
+		struct do_action
+		{
+			template<typename scalar_t, size_t space_mask, size_t rank_size>
+			do_action(std::vector<sparse_term_t<scalar_t>>& terms, const sparse_term_t<scalar_t>& term, const multivector_t<scalar_t, space_mask, rank_size>& dense)
+			{
+				using sign_traits = dense_sign_traits<blade_mask>;
+				const scalar_t value = dense.components[index];
+				if (value == scalar_t(0) || (term.blade_mask & sign_traits::zero_mask) != 0)
+					return;
+				const scalar_t product = is_dense_first ? (value * term.value) : (term.value * value);
+				if ((SBLib::count_bits(term.blade_mask & sign_traits::parity_mask) & 1) != 0)
+					terms.push_back({ term.blade_mask ^ blade_mask, -product });
+				else
+					terms.push_back({ term.blade_mask ^ blade_mask, product });
+			}
+		};
+	};
+	template<bool is_dense_first, typename scalar_t, size_t space_mask, size_t rank_size>
+	static auto product(const sparse_multivector_t<scalar_t, space_mask>& u, const multivector_t<scalar_t, space_mask, rank_size>& dense)
+	{
+		typename sparse_multivector_t<scalar_t, space_mask>::container_type terms;
+		terms.reserve(u.size() * multivector_t<scalar_t, space_mask, rank_size>::dimension_size);
+		for (const auto& term : u.terms)
+			for_each_combination<select_combinations<space_mask, rank_size>>::iterate<dense_helper<is_dense_first>::do_action>(terms, term, dense);
+		return sparse_multivector_t<scalar_t, space_mask>(std::move(terms));
+	}
+};
+
+template<typename metric_type = SBLib::euclidian_metric, typename scalar_t, size_t space_mask>
+inline auto geometric_product(const sparse_multivector_t<scalar_t, space_mask>& u, const sparse_multivector_t<scalar_t, space_mask>& v)
+{
+	return sparse_product_traits<metric_type, false>::product(u, v);
+}
+template<typename metric_type = SBLib::euclidian_metric, typename scalar_t, size_t space_mask, size_t rank_size>
+inline auto geometric_product(const sparse_multivector_t<scalar_t, space_mask>& u, const multivector_t<scalar_t, space_mask, rank_size>& v)
+{
+	return sparse_product_traits<metric_type, false>::product<false>(u, v);
+}
+template<typename metric_type = SBLib::euclidian_metric, typename scalar_t, size_t space_mask, size_t rank_size>
+inline auto geometric_product(const multivector_t<scalar_t, space_mask, rank_size>& u, const sparse_multivector_t<scalar_t, space_mask>& v)
+{
+	return sparse_product_traits<metric_type, false>::product<true>(v, u);
+}
+
+template<typename scalar_t, size_t space_mask>
+inline auto wedge_product(const sparse_multivector_t<scalar_t, space_mask>& u, const sparse_multivector_t<scalar_t, space_mask>& v)
+{
+	return sparse_product_traits<SBLib::euclidian_metric, true>::product(u, v);
+}
+template<typename scalar_t, size_t space_mask, size_t rank_size>
+inline auto wedge_product(const sparse_multivector_t<scalar_t, space_mask>& u, const multivector_t<scalar_t, space_mask, rank_size>& v)
+{
+	return sparse_product_traits<SBLib::euclidian_metric, true>::product<false>(u, v);
+}
+template<typename scalar_t, size_t space_mask, size_t rank_size>
+inline auto wedge_product(const multivector_t<scalar_t, space_mask, rank_size>& u, const sparse_multivector_t<scalar_t, space_mask>& v)
+{
+	return sparse_product_traits<SBLib::euclidian_metric, true>::product<true>(v, u);
+}
+
+template<typename scalar_t, size_t space_mask>
+inline auto operator *(const sparse_multivector_t<scalar_t, space_mask>& u, const sparse_multivector_t<scalar_t, space_mask>& v)
+{
+	return geometric_product(u, v);
+}
+template<typename scalar_t, size_t space_mask>
+inline auto operator ^(const sparse_multivector_t<scalar_t, space_mask>& u, const sparse_multivector_t<scalar_t, space_mask>& v)
+{
+	return wedge_product(u, v);
+}
+template<typename scalar_t, size_t space_mask, size_t rank_size>
+inline auto operator ^(const sparse_multivector_t<scalar_t, space_mask>& u, const multivector_t<scalar_t, space_mask, rank_size>& v)
+{
+	return wedge_product(u, v);
+}
+template<typename scalar_t, size_t space_mask, size_t rank_size>
+inline auto operator ^(const multivector_t<scalar_t, space_mask, rank_size>& u, const sparse_multivector_t<scalar_t, space_mask>& v)
+{
+	return wedge_product(u, v);
+}
+} // namespace SBLib::Mathematics
+namespace SBLib { using namespace Mathematics; }
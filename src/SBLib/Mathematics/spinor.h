@@ -0,0 +1,288 @@
+#pragma once
+#include <Mathematics/geometric_product.h>
+#include <Mathematics/normalization.h>
+#include <Mathematics/sandwich.h>
+#include <cmath>
+#include <type_traits>
+
+#if !defined(USE_SSE_SPINOR)
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE__)
+#define USE_SSE_SPINOR 1
+#else
+#define USE_SSE_SPINOR 0
+#endif
+#endif // #if !defined(USE_SSE_SPINOR)
+
+#if USE_SSE_SPINOR
+#include <xmmintrin.h>
+#endif // #if USE_SSE_SPINOR
+
+namespace SBLib::Mathematics
+{
+//
+// spinor_traits
+// Layout of the even subalgebra of a space of a given dimension : grades 0, 2, 4, ... stored one after the other, each
+// grade in multivector_t order, for a total of 2^(dimension - 1) components.
+//
+template<size_t dimension_size>
+struct spinor_traits
+{
+private:
+	static constexpr size_t get_grade_mask()
+	{
+		size_t grade_mask = 0;
+		for (size_t rank = 0; rank <= dimension_size; rank += 2)
+			grade_mask |= (size_t(1) << rank);
+		return grade_mask;
+	}
+public:
+	static constexpr size_t get_grade_offset(size_t rank_size)
+	{
+		size_t offset = 0;
+		for (size_t rank = 0; rank < rank_size; rank += 2)
+		{
+			size_t count = 1;
+			for (size_t index = 0; index < rank; ++index)
+				count = count * (dimension_size - index) / (index + 1);
+			offset += count;
+		}
+		return offset;
+	}
+	enum : size_t
+	{
+		grade_mask      = get_grade_mask(),
+		component_count = (dimension_size > 0) ? (size_t(1) << (dimension_size - 1)) : 1,
+	};
+};
+
+//
+// spinor_t
+// Even-grade multivector (scalar + bivectors + 4-vectors + ...) packed contiguously, as opposed to versor_t which keeps
+// every grade in its own multivector_t. In 3-D, bivectors are stored as (e1^e2, e0^e2, e0^e1), which is the quaternion basis
+// (i, j, k) of combinations.h : a 3-D float spinor is a single 16-byte aligned (w, i, j, k) register and its geometric product
+// is the Hamilton product, computed with shuffles when USE_SSE_SPINOR is set. Other spinors go through versor_t products.
+//
+template<typename scalar_t, size_t space_mask>
+struct alignas((sizeof(scalar_t) * spinor_traits<SBLib::bit_traits<space_mask>::population_count>::component_count < 16) ? sizeof(scalar_t) * spinor_traits<SBLib::bit_traits<space_mask>::population_count>::component_count : 16)
+spinor_t
+{
+private:
+	using traits = spinor_traits<SBLib::bit_traits<space_mask>::population_count>;
+
+	template<size_t rank_size>
+	void load_part(const multivector_t<scalar_t, space_mask, rank_size>& part)
+	{
+		enum : size_t { offset = traits::get_grade_offset(rank_size), };
+		for (size_t index = 0; index < multivector_t<scalar_t, space_mask, rank_size>::dimension_size; ++index)
+			components[offset + index] = part.components[index];
+	}
+	template<size_t rank_size>
+	void store_part(multivector_t<scalar_t, space_mask, rank_size>& part) const
+	{
+		enum : size_t { offset = traits::get_grade_offset(rank_size), };
+		for (size_t index = 0; index < multivector_t<scalar_t, space_mask, rank_size>::dimension_size; ++index)
+			part.components[index] = components[offset + index];
+	}
+
+public:
+	enum : size_t
+	{
+		space_mask      = space_mask,
+		dimension_size  = traits::component_count,
+		grade_mask      = traits::grade_mask,
+		is_packed       = std::is_same_v<scalar_t, float> && (dimension_size == 4),
+	};
+	using components_type = canonical_components_t<scalar_t, dimension_size>;
+	using scalar_type     = typename components_type::scalar_type;
+	using versor_type     = typename versor_from_grade_mask<scalar_t, space_mask, grade_mask>::type;
+
+	enum eUNINITIALIZED : bool { UNINITIALIZED = true, };
+	spinor_t(eUNINITIALIZED) : components(components_type::UNINITIALIZED) {};
+
+	spinor_t() : components() {};
+	spinor_t(const spinor_t& v) : components(v.components) {};
+	explicit spinor_t(const components_type& v) : components(v) {};
+	explicit spinor_t(components_type&& v) : components(v) {};
+	explicit spinor_t(const versor_type& versor) : components(components_type::UNINITIALIZED)
+	{
+		std::apply([this](const auto&... parts) { (load_part(parts), ...); }, versor);
+	}
+
+	const spinor_t& operator =(const spinor_t& v) { components = v.components; return *this; };
+
+	versor_type to_versor() const
+	{
+		versor_type result;
+		std::apply([this](auto&... parts) { (store_part(parts), ...); }, result);
+		return std::move(result);
+	}
+	template<size_t rank_size>
+	multivector_t<scalar_t, space_mask, rank_size> get_part() const
+	{
+		static_assert(((size_t(1) << rank_size) & grade_mask) != 0, "Spinors only hold even grades.");
+		multivector_t<scalar_t, space_mask, rank_size> part(multivector_t<scalar_t, space_mask, rank_size>::UNINITIALIZED);
+		store_part(part);
+		return std::move(part);
+	}
+
+	components_type components;
+};
+
+#if USE_SSE_SPINOR
+//
+// packed_spinor_helper
+// 3-D float spinor kernels on (w, i, j, k) registers. The Hamilton product a b is
+//	a_w (b_w, b_i, b_j, b_k) + a_i (-b_i, b_w, -b_k, b_j) + a_j (-b_j, b_k, b_w, -b_i) + a_k (-b_k, -b_j, b_i, b_w)
+// that is three lane permutations of b with sign flips, four broadcasts of a, four products and three additions.
+//
+struct packed_spinor_helper
+{
+	template<size_t space_mask>
+	static __m128 load(const spinor_t<float, space_mask>& u) { return _mm_load_ps(&u.components[0]); }
+	template<size_t space_mask>
+	static void store(spinor_t<float, space_mask>& u, __m128 value) { _mm_store_ps(&u.components[0], value); }
+
+	static __m128 product(__m128 a, __m128 b)
+	{
+		// _mm_set_ps takes lanes in (k, j, i, w) order
+		const __m128 sign_i = _mm_set_ps(+0.0f, -0.0f, +0.0f, -0.0f);
+		const __m128 sign_j = _mm_set_ps(-0.0f, +0.0f, +0.0f, -0.0f);
+		const __m128 sign_k = _mm_set_ps(+0.0f, +0.0f, -0.0f, -0.0f);
+		const __m128 a_w = _mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 0, 0));
+		const __m128 a_i = _mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 1, 1, 1));
+		const __m128 a_j = _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 2, 2));
+		const __m128 a_k = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 b_i = _mm_xor_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 3, 0, 1)), sign_i);
+		const __m128 b_j = _mm_xor_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2)), sign_j);
+		const __m128 b_k = _mm_xor_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 1, 2, 3)), sign_k);
+		return _mm_add_ps(_mm_add_ps(_mm_mul_ps(a_w, b), _mm_mul_ps(a_i, b_i)), _mm_add_ps(_mm_mul_ps(a_j, b_j), _mm_mul_ps(a_k, b_k)));
+	}
+	static __m128 conjugate(__m128 a)
+	{
+		return _mm_xor_ps(a, _mm_set_ps(-0.0f, -0.0f, -0.0f, +0.0f));
+	}
+	// squared norm broadcast to every lane
+	static __m128 norm_squared(__m128 a)
+	{
+		const __m128 square = _mm_mul_ps(a, a);
+		const __m128 pairs  = _mm_add_ps(square, _mm_shuffle_ps(square, square, _MM_SHUFFLE(2, 3, 0, 1)));
+		return _mm_add_ps(pairs, _mm_shuffle_ps(pairs, pairs, _MM_SHUFFLE(1, 0, 3, 2)));
+	}
+	static __m128 normalize(__m128 a)
+	{
+#if USE_SSE_RSQRT
+		return _mm_mul_ps(a, reciprocal_sqrt(norm_squared(a)));
+#else
+		return _mm_div_ps(a, _mm_sqrt_ps(norm_squared(a)));
+#endif // #if USE_SSE_RSQRT
+	}
+};
+#endif // #if USE_SSE_SPINOR
+
+
+//
+// Arithmetic
+//
+template<typename scalar_t, size_t space_mask>
+inline auto operator +(const spinor_t<scalar_t, space_mask>& u, const spinor_t<scalar_t, space_mask>& v)
+{
+	return spinor_t<scalar_t, space_mask>(std::move(u.components + v.components));
+}
+template<typename scalar_t, size_t space_mask>
+inline auto operator -(const spinor_t<scalar_t, space_mask>& u, const spinor_t<scalar_t, space_mask>& v)
+{
+	return spinor_t<scalar_t, space_mask>(std::move(u.components - v.components));
+}
+template<typename scalar_t, size_t space_mask>
+inline auto operator *(const spinor_t<scalar_t, space_mask>& u, const scalar_t& scale)
+{
+	return spinor_t<scalar_t, space_mask>(std::move(u.components * scale));
+}
+template<typename scalar_t, size_t space_mask>
+inline auto operator *(const scalar_t& scale, const spinor_t<scalar_t, space_mask>& u)
+{
+	return std::move(u * scale);
+}
+
+//
+// Geometric (Euclidian) product of spinors, closed over the even subalgebra.
+//
+template<typename scalar_t, size_t space_mask>
+inline auto geometric_product(const spinor_t<scalar_t, space_mask>& u, const spinor_t<scalar_t, space_mask>& v)
+{
+	using spinor_type = spinor_t<scalar_t, space_mask>;
+#if USE_SSE_SPINOR
+	if constexpr (spinor_type::is_packed)
+	{
+		spinor_type result(spinor_type::UNINITIALIZED);
+		packed_spinor_helper::store(result, packed_spinor_helper::product(packed_spinor_helper::load(u), packed_spinor_helper::load(v)));
+		return std::move(result);
+	}
+	else
+#endif // #if USE_SSE_SPINOR
+	return spinor_type(geometric_product(u.to_versor(), v.to_versor()));
+}
+template<typename scalar_t, size_t space_mask>
+inline auto operator *(const spinor_t<scalar_t, space_mask>& u, const spinor_t<scalar_t, space_mask>& v)
+{
+	return geometric_product(u, v);
+}
+
+//
+// conjugate
+// Reversion S -> S~, i.e., the quaternion conjugate in 3-D (the inverse of a unit spinor).
+//
+template<typename scalar_t, size_t space_mask>
+inline auto conjugate(const spinor_t<scalar_t, space_mask>& u)
+{
+	using spinor_type = spinor_t<scalar_t, space_mask>;
+#if USE_SSE_SPINOR
+	if constexpr (spinor_type::is_packed)
+	{
+		spinor_type result(spinor_type::UNINITIALIZED);
+		packed_spinor_helper::store(result, packed_spinor_helper::conjugate(packed_spinor_helper::load(u)));
+		return std::move(result);
+	}
+	else
+#endif // #if USE_SSE_SPINOR
+	return spinor_type(reverse(u.to_versor()));
+}
+
+//
+// norm_squared / normalize
+// Scalar part of S S~, which is the sum of the squared components in the Euclidian metric.
+//
+template<typename scalar_t, size_t space_mask>
+inline scalar_t norm_squared(const spinor_t<scalar_t, space_mask>& u)
+{
+	scalar_t result = scalar_t(0);
+	for (size_t index = 0; index < spinor_t<scalar_t, space_mask>::dimension_size; ++index)
+		result += u.components[index] * u.components[index];
+	return result;
+}
+template<typename scalar_t, size_t space_mask>
+inline auto normalize(const spinor_t<scalar_t, space_mask>& u)
+{
+	using spinor_type = spinor_t<scalar_t, space_mask>;
+#if USE_SSE_SPINOR
+	if constexpr (spinor_type::is_packed)
+	{
+		spinor_type result(spinor_type::UNINITIALIZED);
+		packed_spinor_helper::store(result, packed_spinor_helper::normalize(packed_spinor_helper::load(u)));
+		return std::move(result);
+	}
+	else
+#endif // #if USE_SSE_SPINOR
+	return std::move(u * reciprocal_sqrt(norm_squared(u)));
+}
+
+//
+// Application to a multivector through the fused sandwich product (c.f., sandwich.h).
+//
+template<typename scalar_t, size_t space_mask, size_t rank_size>
+inline auto sandwich(const spinor_t<scalar_t, space_mask>& spinor, const multivector_t<scalar_t, space_mask, rank_size>& x)
+{
+	return sandwich(spinor.to_versor(), x);
+}
+} // namespace SBLib::Mathematics
+namespace SBLib { using namespace Mathematics; }
@@ -0,0 +1,95 @@
+#include <Mathematics/binomial_coefficient.h>
+#include <utility>
+using namespace SBLib;
+
+//
+// Compile-time benchmark of binomial_coefficient over every (n, k) in [-max_benchmark_dimension, max_benchmark_dimension]^2.
+// Build this file alone (it generates no code) with BINOMIAL_COEFFICIENT_BENCHMARK_RECURSIVE defined to time the former
+// Pascal-rule recursion (one class per (n, k) reached by the recursion), or undefined to time the constexpr table
+// (one class per (n, k) requested). With MSVC, /Bt+ or /d1reportTime show the front-end time ; below, g++ 12 -fsyntax-only,
+// best of 5, for the whole file (0.10s without BENCHMARK_UNIT_TESTS) :
+//
+//	max_benchmark_dimension   recursive classes   recursive time   table classes   table time
+//	                      8                 361            0.13s             289        0.10s
+//	                     16                1361            0.27s            1089        0.13s
+//	                     32                5281            0.80s            4225        0.24s
+//
+// Memoization keeps the recursion from exploding, so the class counts stay close : the gain is mostly in the per-class
+// cost, since the table version has no enum arithmetic to resolve and no dependent base recursion to walk.
+//
+#if defined( BENCHMARK_UNIT_TESTS )
+#define BENCHMARK_BINOMIAL_COEFFICIENTS
+#endif
+
+#if !defined( MAX_BINOMIAL_COEFFICIENT_BENCHMARK_DIMENSION )
+#define MAX_BINOMIAL_COEFFICIENT_BENCHMARK_DIMENSION 16
+#endif
+
+#if defined( BENCHMARK_BINOMIAL_COEFFICIENTS )
+namespace
+{
+	enum
+	{
+		max_benchmark_dimension = MAX_BINOMIAL_COEFFICIENT_BENCHMARK_DIMENSION,
+		benchmark_size          = 2 * max_benchmark_dimension + 1,
+	};
+
+#if defined( BINOMIAL_COEFFICIENT_BENCHMARK_RECURSIVE )
+	// former implementation (Pascal rule with the reflection identities), kept here for reference
+	template<int dimension_size, int rank_size>
+	struct benchmark_binomial_coefficient
+	{
+	private:
+		enum
+		{
+			omega_0 = rank_size - dimension_size - 1,
+			omega_1 = -1 - rank_size,
+			omega_2 = -1 - dimension_size,
+			sigma_0 = +1,
+			sigma_1 = (rank_size & 1) == 0 ? +1 : -1,
+			sigma_2 = ((dimension_size - rank_size) & 1) == 0 ? +1 : -1,
+
+			minimal_dimension = (omega_0 >= 0) ? omega_0   : omega_1,
+			minimal_rank      = (omega_0 >= 0) ? rank_size : omega_2,
+			minimal_sign      = (omega_0 >= 0) ? sigma_1   : sigma_2,
+			n    = (dimension_size >= 0) ? dimension_size : minimal_dimension,
+			k    = (dimension_size >= 0) ? rank_size : minimal_rank,
+			sign = (dimension_size >= 0) ? sigma_0   : minimal_sign,
+
+			projection = (n >= 0) && ((k < 0) || (k > n)) ? 0 : +1,
+		};
+	public:
+		enum : long long
+		{
+			value = projection * sign * (benchmark_binomial_coefficient<n - 1, k - 1>::value + benchmark_binomial_coefficient<n - 1, k>::value)
+		};
+	};
+	template<> struct benchmark_binomial_coefficient<0, 0> { enum { value = 1 }; };
+	template<int dimension_size> struct benchmark_binomial_coefficient<dimension_size, 0> { enum { value = 1 }; };
+	template<int dimension_size> struct benchmark_binomial_coefficient<dimension_size, dimension_size> { enum { value = 1 }; };
+	template<> struct benchmark_binomial_coefficient<-1, 0> { enum { value = 1 }; };
+	template<> struct benchmark_binomial_coefficient<-1, -1> { enum { value = 1 }; };
+	template<int rank_size>
+	struct benchmark_binomial_coefficient<-1, rank_size>
+	{
+		enum { value = (rank_size >= 0) ? 1 - 2 * (rank_size & 1) : 2 * (rank_size & 1) - 1, };
+	};
+#else
+	template<int dimension_size, int rank_size>
+	using benchmark_binomial_coefficient = binomial_coefficient<dimension_size, rank_size>;
+#endif
+
+	template<int dimension_size, int... rank_sizes>
+	constexpr long long get_benchmark_row_checksum(std::integer_sequence<int, rank_sizes...>)
+	{
+		return (benchmark_binomial_coefficient<dimension_size, rank_sizes - max_benchmark_dimension>::value + ...);
+	}
+	template<int... dimension_sizes>
+	constexpr long long get_benchmark_checksum(std::integer_sequence<int, dimension_sizes...>)
+	{
+		return (get_benchmark_row_checksum<dimension_sizes - max_benchmark_dimension>(std::make_integer_sequence<int, benchmark_size>()) + ...);
+	}
+	// sum over a square of Pascal's triangle extended to negative arguments
+	static_assert(get_benchmark_checksum(std::make_integer_sequence<int, benchmark_size>()) != 0, "Invalid binomial coefficients");
+}
+#endif
@@ -34,6 +34,64 @@ static_assert(alternating_traits<e0, e1, false>::bit_set == e10, "Invalid wedge
 static_assert(alternating_traits<e1, e0, false>::sign    == +1,  "Invalid wedge product sign");
 static_assert(alternating_traits<e1, e0, false>::bit_set == e10, "Invalid wedge product");
 
+// geometric product check (common vectors contract, e_i e_i = +1)
+static_assert(geometric_traits<e0, e0, true>::sign       == +1,   "Invalid geometric product sign");
+static_assert(geometric_traits<e0, e0, true>::bit_set    == e,    "Invalid geometric product");
+static_assert(geometric_traits<e1, e0, true>::sign       == -1,   "Invalid geometric product sign");
+static_assert(geometric_traits<e01, e01, true>::sign     == -1,   "Invalid geometric product sign");
+static_assert(geometric_traits<e01, e12, true>::sign     == +1,   "Invalid geometric product sign");
+static_assert(geometric_traits<e01, e12, true>::bit_set  == e02,  "Invalid geometric product");
+static_assert(geometric_traits<e12, e01, true>::sign     == -1,   "Invalid geometric product sign");
+static_assert(geometric_traits<e012, e012, true>::sign   == -1,   "Invalid geometric product sign");
+static_assert(geometric_traits<e012, e1, true>::bit_set  == e02,  "Invalid geometric product");
+static_assert(geometric_traits<e0, e1, false>::sign      == -1,   "Invalid geometric product sign");
+static_assert(geometric_traits<e10, e10, false>::sign    == -1,   "Invalid geometric product sign");
+
+// metric signature check : spacetime (1, 3), projective (3, 0, 1) and conformal (4, 1)
+static_assert(spacetime_metric::negative_mask  == (e1|e2|e3), "Invalid metric signature");
+static_assert(spacetime_metric::null_mask      == e,          "Invalid metric signature");
+static_assert(projective_metric::negative_mask == e,          "Invalid metric signature");
+static_assert(projective_metric::null_mask     == e3,         "Invalid metric signature");
+static_assert(conformal_metric::negative_mask  == (1 << 4),   "Invalid metric signature");
+static_assert(metric_traits<e0,   spacetime_metric>::sign  == +1, "Invalid metric sign");
+static_assert(metric_traits<e1,   spacetime_metric>::sign  == -1, "Invalid metric sign");
+static_assert(metric_traits<e12,  spacetime_metric>::sign  == +1, "Invalid metric sign");
+static_assert(metric_traits<e123, spacetime_metric>::sign  == -1, "Invalid metric sign");
+static_assert(metric_traits<e012, projective_metric>::sign == +1, "Invalid metric sign");
+static_assert(metric_traits<e03,  projective_metric>::sign ==  0, "Invalid metric sign");
+// geometric product with metric : common vectors contract to their square, null ones to zero
+static_assert(geometric_traits<e1, e1, true, spacetime_metric>::sign     == -1,  "Invalid geometric product sign");
+static_assert(geometric_traits<e01, e01, true, spacetime_metric>::sign   == +1,  "Invalid geometric product sign");
+static_assert(geometric_traits<e01, e12, true, spacetime_metric>::sign   == -1,  "Invalid geometric product sign");
+static_assert(geometric_traits<e3, e3, true, projective_metric>::sign    ==  0,  "Invalid geometric product sign");
+static_assert(geometric_traits<e03, e13, true, projective_metric>::sign  ==  0,  "Invalid geometric product sign");
+static_assert(geometric_traits<e03, e12, true, projective_metric>::sign  == +1,  "Invalid geometric product sign");
+static_assert(geometric_traits<e03, e12, true, projective_metric>::bit_set == e0123, "Invalid geometric product");
+// metric hodge dual : B ^ *B = (B.B) *1
+static_assert(hodge_conjugacy_traits<e1, e0123, true, spacetime_metric>::sign  == +1, "Invalid hodge conjugacy sign");
+static_assert(hodge_conjugacy_traits<e0, e0123, true, spacetime_metric>::sign  == +1, "Invalid hodge conjugacy sign");
+static_assert(hodge_conjugacy_traits<e3, e0123, true, projective_metric>::sign ==  0, "Invalid hodge conjugacy sign");
+static_assert(hodge_conjugacy_traits<e01, e0123, true, spacetime_metric>::sign == -1, "Invalid hodge conjugacy sign");
+
+// runtime blade signs agree with the traits
+static_assert(get_population_count(e0123) == 4 && get_population_count(~0ull) == 64, "Invalid population count");
+static_assert(get_prefix_parity_mask(e0|e2) == (e1|e2) && get_prefix_parity_mask(1ull << 63) == 0, "Invalid prefix parity mask");
+static_assert(get_permutation_parity(e02, e13)            == (get_permutation_count(e02, e13) & 1),            "Invalid permutation parity");
+static_assert(get_permutation_parity<false>(e02, e13)     == (get_permutation_count<false>(e02, e13) & 1),     "Invalid permutation parity");
+static_assert(get_permutation_parity(e0123, e0123)        == (get_permutation_count(e0123, e0123) & 1),        "Invalid permutation parity");
+static_assert(get_permutation_parity<false>(e12, e0|e3)   == (get_permutation_count<false>(e12, e0|e3) & 1),   "Invalid permutation parity");
+static_assert(get_permutation_parity(1ull << 63, ~0ull >> 1) == 1 && get_permutation_parity<false>(1ull << 63, ~0ull >> 1) == 0, "Invalid permutation parity");
+static_assert(get_alternating_sign(e012, e3)    == alternating_traits<e012, e3>::sign,          "Invalid runtime wedge product sign");
+static_assert(get_alternating_sign(e0|e2, e1|e3) == alternating_traits<e0|e2, e1|e3>::sign,      "Invalid runtime wedge product sign");
+static_assert(get_alternating_sign<false>(e0, e1) == alternating_traits<e0, e1, false>::sign,    "Invalid runtime wedge product sign");
+static_assert(get_alternating_sign(e01, e12)    == 0,                                            "Invalid runtime wedge product sign");
+static_assert(get_geometric_sign(e12, e01)      == geometric_traits<e12, e01>::sign,             "Invalid runtime geometric product sign");
+static_assert(get_geometric_sign(e012, e012)    == geometric_traits<e012, e012>::sign,           "Invalid runtime geometric product sign");
+static_assert(get_geometric_sign<euclidian_metric, false>(e10, e10) == geometric_traits<e10, e10, false>::sign, "Invalid runtime geometric product sign");
+static_assert(get_geometric_sign<spacetime_metric>(e01, e12)  == geometric_traits<e01, e12, true, spacetime_metric>::sign,  "Invalid runtime geometric product sign");
+static_assert(get_geometric_sign<projective_metric>(e03, e13) == geometric_traits<e03, e13, true, projective_metric>::sign, "Invalid runtime geometric product sign");
+static_assert(get_geometric_sign<projective_metric>(e03, e12) == geometric_traits<e03, e12, true, projective_metric>::sign, "Invalid runtime geometric product sign");
+
 // reversion parity check (ordering independant)
 static_assert(reversion_conjugacy_traits<e   >::sign == +1, "Invalid reversion conjugacy sign");
 static_assert(reversion_conjugacy_traits<e0  >::sign == +1, "Invalid reversion conjugacy sign");
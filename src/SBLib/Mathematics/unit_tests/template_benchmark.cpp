@@ -0,0 +1,100 @@
+#include <Mathematics/exterior_algebra.h>
+#if defined( TEMPLATE_BENCHMARK_PREBUILT )
+#include <Mathematics/prebuilt_algebra.h>
+#endif
+using namespace SBLib;
+
+//
+// Compile-time benchmark of the exterior algebra templates in a benchmark_dimension-D space : for every rank, combinations
+// (select_combinations and combination_table through for_each_combination), multivector_t, hodge_conjugate, and the wedge
+// product of a rank-benchmark_wedge_rank multivector with it whenever the result fits in the space. Building this file
+// alone measures one dimension ; compile_benchmark.py (next to SBLib.sln) builds it for dimensions 2 to 12, records compile
+// time, peak compiler memory and, with clang-cl, template instantiation counts from -ftime-trace, and writes a report which
+// can be compared against a previous one to spot compile-time regressions.
+//
+// With TEMPLATE_BENCHMARK_PREBUILT defined, the products and Hodge conjugates of the 2-D to 5-D spaces are declared extern
+// (c.f., prebuilt_algebra.h) : comparing both builds over those dimensions shows what linking SBLib_prebuilt.lib saves.
+//
+// Wedge products cost C(n, benchmark_wedge_rank) * C(n, rank) instantiations each, so benchmark_wedge_rank stays at 1 by
+// default : all rank pairs would be out of reach above 8-D.
+//
+#if defined( BENCHMARK_UNIT_TESTS )
+#define BENCHMARK_TEMPLATES
+#endif
+
+#if !defined( TEMPLATE_BENCHMARK_DIMENSION )
+#define TEMPLATE_BENCHMARK_DIMENSION 6
+#endif
+#if !defined( TEMPLATE_BENCHMARK_WEDGE_RANK )
+#define TEMPLATE_BENCHMARK_WEDGE_RANK 1
+#endif
+
+#if defined( BENCHMARK_TEMPLATES )
+namespace
+{
+	enum : size_t
+	{
+		benchmark_dimension  = TEMPLATE_BENCHMARK_DIMENSION,
+		benchmark_wedge_rank = TEMPLATE_BENCHMARK_WEDGE_RANK,
+		benchmark_space_mask = (size_t(1) << benchmark_dimension) - 1,
+	};
+	static_assert(benchmark_wedge_rank <= benchmark_dimension, "Wedge operand rank exceeds the benchmark dimension");
+
+	struct benchmark_helper
+	{
+		template<size_t blade_mask, size_t index>
+		struct fill
+		{
+			template<typename multivec_t>
+			fill(multivec_t& u)
+			{
+				u.get<blade_mask>() = float(index + 1);
+			}
+		};
+		template<size_t blade_mask, size_t index>
+		struct accumulate
+		{
+			template<typename multivec_t>
+			accumulate(float& checksum, const multivec_t& u)
+			{
+				checksum += u.get<blade_mask>();
+			}
+		};
+
+		template<size_t rank_size>
+		static auto get_multivector()
+		{
+			multivector_t<float, benchmark_space_mask, rank_size> u;
+			for_each_combination<select_combinations<benchmark_space_mask, rank_size>>::iterate<fill>(u);
+			return std::move(u);
+		}
+		template<size_t rank_size>
+		static float get_checksum(const multivector_t<float, benchmark_space_mask, rank_size>& u)
+		{
+			float checksum = 0.0f;
+			for_each_combination<select_combinations<benchmark_space_mask, rank_size>>::iterate<accumulate>(checksum, u);
+			return checksum;
+		}
+
+		template<size_t rank_size, size_t index>
+		struct do_action
+		{
+			do_action(float& checksum)
+			{
+				const auto u = get_multivector<rank_size>();
+				checksum += get_checksum(u) + get_checksum(hodge_conjugate(u));
+				if constexpr (benchmark_wedge_rank + rank_size <= benchmark_dimension)
+					checksum += get_checksum(wedge_product(get_multivector<benchmark_wedge_rank>(), u));
+			}
+		};
+	};
+}
+
+// external linkage, so that code is generated for every instantiation
+float get_template_benchmark_checksum()
+{
+	float checksum = 0.0f;
+	static_for_each<0, benchmark_dimension + 1>::iterate<benchmark_helper::do_action>(checksum);
+	return checksum;
+}
+#endif
@@ -0,0 +1,85 @@
+#include <test_common.h>
+#include <Traits/bit_traits.h>
+
+#include <chrono>
+#include <random>
+#include <vector>
+
+#ifdef USE_CURRENT_TEST
+#undef USE_CURRENT_TEST
+#endif
+#define USE_CURRENT_TEST 1
+
+namespace SBLib::Test
+{
+class test_bit_traits : public RegisteredFunctor
+{
+	enum : size_t
+	{
+		sparse_mask = (1 << 1) | (1 << 5) | (1 << 6) | (1 << 7) | (1 << 9) | (1 << 12) | (1 << 13) | (1 << 15),
+	};
+
+	// compile-time bit_traits against the runtime kernels, bit after bit
+	template<size_t bit_mask>
+	struct compare_helper
+	{
+		template<size_t bit, size_t index>
+		struct do_action
+		{
+			do_action(size_t& error_count)
+			{
+				error_count += (SBLib::bit_traits<bit_mask>::get_bit<index>() != SBLib::deposit_bits(size_t(1) << index, bit_mask)) ? 1 : 0;
+				error_count += (SBLib::bit_traits<bit_mask>::get_bit_component<bit>() != SBLib::count_trailing_zeros(SBLib::extract_bits(bit, bit_mask))) ? 1 : 0;
+				error_count += (SBLib::bit_traits<bit_mask>::get_bit_index<bit>() != SBLib::count_trailing_zeros(bit)) ? 1 : 0;
+			}
+		};
+	};
+	template<size_t bit_mask>
+	static size_t get_error_count()
+	{
+		size_t error_count = (SBLib::bit_traits<bit_mask>::population_count != SBLib::count_bits(bit_mask)) ? 1 : 0;
+		SBLib::for_each_bit<bit_mask>::iterate<compare_helper<bit_mask>::do_action>(error_count);
+		return error_count;
+	}
+
+	test_bit_traits() : RegisteredFunctor(__FUNCTION__, fct) {}
+	static void fct()
+	{
+		std::cout << "bit_traits against runtime kernels : " << get_error_count<sparse_mask>() + get_error_count<(1 << 16) - 1>() + get_error_count<~size_t(0)>() << " errors" << std::endl;
+
+		//
+		// deposit_bits / extract_bits against the constexpr loops on random masks
+		//
+		std::mt19937_64 generator(0);
+		enum : size_t { batch_size = (1 << 20), };
+		std::vector<size_t> bits(batch_size), masks(batch_size), results(batch_size), references(batch_size);
+		for (size_t index = 0; index < batch_size; ++index)
+		{
+			bits[index]  = generator();
+			masks[index] = generator() & generator();
+		}
+
+		const auto start_kernel = std::chrono::high_resolution_clock::now();
+		for (size_t index = 0; index < batch_size; ++index)
+			results[index] = SBLib::deposit_bits(SBLib::extract_bits(bits[index], masks[index]), masks[index]);
+		const auto end_kernel = std::chrono::high_resolution_clock::now();
+
+		const auto start_reference = std::chrono::high_resolution_clock::now();
+		for (size_t index = 0; index < batch_size; ++index)
+			references[index] = size_t(SBLib::get_deposited_bits(SBLib::get_extracted_bits(bits[index], masks[index]), masks[index]));
+		const auto end_reference = std::chrono::high_resolution_clock::now();
+
+		size_t error_count = 0;
+		for (size_t index = 0; index < batch_size; ++index)
+			error_count += (results[index] != references[index] || results[index] != (bits[index] & masks[index])) ? 1 : 0;
+		std::cout << batch_size << " extract / deposit : " << std::chrono::duration<double, std::milli>(end_kernel - start_kernel).count() << "ms ("
+			<< (USE_BMI2_BIT_KERNELS ? "BMI2" : "loops") << ") vs " << std::chrono::duration<double, std::milli>(end_reference - start_reference).count()
+			<< "ms (constexpr loops), " << error_count << " errors" << std::endl;
+	}
+
+	static test_bit_traits instance;
+};
+#if USE_CURRENT_TEST
+test_bit_traits test_bit_traits::instance;
+#endif // #if USE_CURRENT_TEST
+} // namespace SBLib::Test
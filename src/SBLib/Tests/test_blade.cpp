@@ -0,0 +1,94 @@
+#include <test_common.h>
+#include <Mathematics/blade.h>
+#include <Mathematics/exterior_algebra.h>
+#include <Mathematics/geometric_product.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#ifdef USE_CURRENT_TEST
+#undef USE_CURRENT_TEST
+#endif
+#define USE_CURRENT_TEST 1
+
+namespace SBLib::Test
+{
+class test_blade : public RegisteredFunctor
+{
+	enum
+	{
+		e0 = (1 << 0), e1 = (1 << 1),
+		e2 = (1 << 2), e3 = (1 << 3),
+	};
+	enum : size_t { space_mask = e0 | e1 | e2, };
+	using vector_type   = vector_t<float, space_mask>;
+	using bivector_type = multivector_t<float, space_mask, 2>;
+
+	// blades multiply at compile time
+	static_assert(std::is_same_v<decltype(blade_t<e0>() * blade_t<e1>()), blade_t<e0 | e1, +1>>, "e0 e1 = e01");
+	static_assert(std::is_same_v<decltype(blade_t<e1>() * blade_t<e0>()), blade_t<e0 | e1, -1>>, "e1 e0 = -e01");
+	static_assert(std::is_same_v<decltype(pseudoscalar_t<space_mask>() * pseudoscalar_t<space_mask>()), blade_t<0, -1>>, "I I = -1 in 3-D");
+	static_assert(std::is_same_v<decltype(blade_t<e0>() ^ blade_t<e0>()), blade_t<0, 0>>, "e0 ^ e0 = 0");
+	// I v has a single grade
+	static_assert(std::is_same_v<decltype(pseudoscalar_t<space_mask>() * std::declval<vector_type>()), bivector_type>, "I v is a bivector");
+
+	test_blade() : RegisteredFunctor(__FUNCTION__, fct) {}
+	static void fct()
+	{
+		const vector_type v{ 1.0f, 2.0f, 3.0f };
+		bivector_type B;
+		B.get<e0 | e1>() = 1.0f;
+		B.get<e0 | e2>() = 2.0f;
+		B.get<e1 | e2>() = 3.0f;
+
+		const auto I  = pseudoscalar_t<space_mask>();
+		const auto E0 = blade_t<e0>();
+		const auto E1 = blade_t<e1>();
+		std::cout << "I v = " << (I * v) << " ~ " << std::get<0>(geometric_product(I.to_multivector<float, space_mask>(), v)) << std::endl;
+		std::cout << "v I = " << (v * I) << " ~ " << std::get<0>(geometric_product(v, I.to_multivector<float, space_mask>())) << std::endl;
+		std::cout << "e1 ^ v = " << (E1 ^ v) << " ~ " << (E1.to_multivector<float, space_mask>() ^ v) << std::endl;
+		std::cout << "e0 ^ B = " << (E0 ^ B) << " ~ " << (E0.to_multivector<float, space_mask>() ^ B) << std::endl;
+		const auto e0B = E0 * B;
+		const auto reference = geometric_product(E0.to_multivector<float, space_mask>(), B);
+		std::cout << "e0 B = " << std::get<0>(e0B) << " + " << std::get<1>(e0B) << " ~ " << std::get<0>(reference) << " + " << std::get<1>(reference) << std::endl;
+		std::cout << "-e1 v = " << std::get<0>(-E1 * v) << " + " << std::get<1>(-E1 * v) << std::endl;
+
+		//
+		// batch : I v through the blade against the general product with the pseudoscalar multivector
+		//
+		std::mt19937 generator(0);
+		std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+		enum : size_t { batch_size = (1 << 20), };
+		std::vector<vector_type> vectors(batch_size);
+		for (auto& vector : vectors)
+			vector = vector_type{ distribution(generator), distribution(generator), distribution(generator) };
+		std::vector<bivector_type> blade_results(batch_size), general_results(batch_size);
+
+		const auto start_blade = std::chrono::high_resolution_clock::now();
+		for (size_t index = 0; index < batch_size; ++index)
+			blade_results[index] = I * vectors[index];
+		const auto end_blade = std::chrono::high_resolution_clock::now();
+
+		const auto pseudoscalar = I.to_multivector<float, space_mask>();
+		const auto start_general = std::chrono::high_resolution_clock::now();
+		for (size_t index = 0; index < batch_size; ++index)
+			general_results[index] = std::get<0>(geometric_product(pseudoscalar, vectors[index]));
+		const auto end_general = std::chrono::high_resolution_clock::now();
+
+		float max_error = 0.0f;
+		for (size_t index = 0; index < batch_size; ++index)
+			for (size_t component = 0; component < bivector_type::dimension_size; ++component)
+				max_error = std::max(max_error, std::abs(blade_results[index].components[component] - general_results[index].components[component]));
+		std::cout << batch_size << " I v : " << std::chrono::duration<double, std::milli>(end_blade - start_blade).count() << "ms (blade_t) vs "
+			<< std::chrono::duration<double, std::milli>(end_general - start_general).count() << "ms (multivector_t), max error " << max_error << std::endl;
+	}
+
+	static test_blade instance;
+};
+#if USE_CURRENT_TEST
+test_blade test_blade::instance;
+#endif // #if USE_CURRENT_TEST
+} // namespace SBLib::Test
@@ -164,6 +164,13 @@ class test_combination : public RegisteredFunctor
 	static void fct()
 	{
 		SBLib::for_each_bit_index<SPACE_PRINT_DIMENSION_MASK>::iterate<do_action>(std::cout);
+
+		// 12-D blade table of the self-conjugate rank against its reverse lookup
+		using table_12 = SBLib::combination_table<(1 << 12) - 1, 6>;
+		size_t mismatch_count = 0;
+		for (size_t index = 0; index < table_12::count; ++index)
+			mismatch_count += (table_12::get_index(table_12::blades[index]) != index) ? 1 : 0;
+		std::cout << "Dim = 12, rank = 6 : " << table_12::count << " blades, " << mismatch_count << " reverse lookup mismatches" << std::endl;
 	}
 	static test_combination instance;
 };
@@ -0,0 +1,109 @@
+#include <test_common.h>
+#include <Mathematics/conformal_algebra.h>
+#include <Mathematics/geometric_product.h>
+
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+#ifdef USE_CURRENT_TEST
+#undef USE_CURRENT_TEST
+#endif
+#define USE_CURRENT_TEST 1
+
+namespace SBLib::Test
+{
+class test_conformal_algebra : public RegisteredFunctor
+{
+	using direction_type = cga_direction_t<float>;
+	using sphere_type    = cga_sphere_t<float>;
+
+	test_conformal_algebra() : RegisteredFunctor(__FUNCTION__, fct) {}
+	static void fct()
+	{
+		const sphere_type unit = make_cga_sphere(direction_type{ 0.0f, 0.0f, 0.0f }, 1.0f);
+		const sphere_type other = make_cga_sphere(direction_type{ 1.5f, 0.0f, 0.0f }, 1.0f);
+		const sphere_type far_away = make_cga_sphere(direction_type{ 5.0f, 0.0f, 0.0f }, 1.0f);
+		std::cout << "S . S = " << cga_inner_product(unit, unit) << " (r^2)" << std::endl;
+		std::cout << "intersects(unit, other/far_away) = " << intersects(unit, other) << " " << intersects(unit, far_away) << std::endl;
+		std::cout << "circle S1 ^ S2 = " << (unit ^ other) << std::endl;
+
+		// flat objects skip n_o entirely : a dual line as the wedge of two dual planes has 6 components
+		const auto line = make_cga_plane(direction_type{ 1.0f, 0.0f, 0.0f }, 0.5f) ^ make_cga_plane(direction_type{ 0.0f, 1.0f, 0.0f }, 0.0f);
+		std::cout << "dual line (" << decltype(line)::dimension_size << " components) = " << line << std::endl;
+
+		// points are null vectors, also in the diagonal basis of conformal_metric
+		const auto point = to_conformal_metric_basis(make_cga_point(direction_type{ 1.0f, 2.0f, 3.0f }));
+		std::cout << "X X = " << std::get<0>(geometric_product<conformal_metric>(point, point)) << std::endl;
+
+		const auto origin = make_cga_point(direction_type{ -3.0f, 0.5f, 0.0f });
+		std::cout << "ray hit at t = " << intersect(unit, origin, direction_type{ 1.0f, 0.0f, 0.0f }) << " ~ " << (3.0f - std::sqrt(0.75f)) << std::endl;
+		std::cout << "ray miss : " << intersect(unit, origin, direction_type{ -1.0f, 0.0f, 0.0f }) << std::endl;
+
+		//
+		// batch : sphere-sphere and sphere-ray tests
+		//
+		std::mt19937 generator(0);
+		std::uniform_real_distribution<float> distribution(-4.0f, 4.0f);
+		enum : size_t { batch_size = (1 << 20), };
+		std::vector<float> streams[5 + 5 + 5 + 3];
+		for (auto& stream : streams)
+			stream.resize(batch_size);
+		for (size_t index = 0; index < batch_size; ++index)
+		{
+			const sphere_type first  = make_cga_sphere(direction_type{ distribution(generator), distribution(generator), distribution(generator) }, 1.0f + 0.25f * std::abs(distribution(generator)));
+			const sphere_type second = make_cga_sphere(direction_type{ distribution(generator), distribution(generator), distribution(generator) }, 1.0f + 0.25f * std::abs(distribution(generator)));
+			const auto ray_origin    = make_cga_point(direction_type{ distribution(generator), distribution(generator), distribution(generator) });
+			for (size_t component = 0; component < 5; ++component)
+			{
+				streams[component][index]      = first.components[component];
+				streams[5 + component][index]  = second.components[component];
+				streams[10 + component][index] = ray_origin.components[component];
+			}
+			for (size_t component = 0; component < 3; ++component)
+				streams[15 + component][index] = distribution(generator);
+		}
+		const cga_sphere_soa_t<float> first{ { streams[0].data(), streams[1].data(), streams[2].data(), streams[3].data(), streams[4].data() }, batch_size };
+		const cga_sphere_soa_t<float> second{ { streams[5].data(), streams[6].data(), streams[7].data(), streams[8].data(), streams[9].data() }, batch_size };
+		const cga_point_soa_t<float> origins{ { streams[10].data(), streams[11].data(), streams[12].data(), streams[13].data(), streams[14].data() }, batch_size };
+		const cga_direction_soa_t<float> directions{ { streams[15].data(), streams[16].data(), streams[17].data() }, batch_size };
+
+		std::unique_ptr<bool[]> hits(new bool[batch_size]);
+		const auto start_spheres = std::chrono::high_resolution_clock::now();
+		intersects(hits.get(), first, second);
+		const auto end_spheres = std::chrono::high_resolution_clock::now();
+		size_t hit_count = 0, mismatch_count = 0;
+		for (size_t index = 0; index < batch_size; ++index)
+		{
+			// reference : |r1 - r2| <= |c1 - c2| <= r1 + r2
+			const sphere_type s1 = first.load(index), s2 = second.load(index);
+			const float r1 = std::sqrt(cga_inner_product(s1, s1)), r2 = std::sqrt(cga_inner_product(s2, s2));
+			const direction_type c1 = s1.project<direction_type>(), c2 = s2.project<direction_type>();
+			const direction_type d = c1 - c2;
+			const float distance = std::sqrt(cga_inner_product(d, d));
+			const bool expected = (std::abs(r1 - r2) <= distance) && (distance <= r1 + r2);
+			hit_count += hits[index] ? 1 : 0;
+			mismatch_count += (hits[index] != expected) ? 1 : 0;
+		}
+		std::cout << batch_size << " sphere-sphere tests : " << std::chrono::duration<double, std::milli>(end_spheres - start_spheres).count() << "ms, "
+			<< hit_count << " hits, " << mismatch_count << " mismatches" << std::endl;
+
+		std::vector<float> distances(batch_size);
+		const auto start_rays = std::chrono::high_resolution_clock::now();
+		intersect(distances.data(), first, origins, directions);
+		const auto end_rays = std::chrono::high_resolution_clock::now();
+		size_t ray_hit_count = 0;
+		for (const float t : distances)
+			ray_hit_count += (t >= 0.0f) ? 1 : 0;
+		std::cout << batch_size << " sphere-ray tests : " << std::chrono::duration<double, std::milli>(end_rays - start_rays).count() << "ms, "
+			<< ray_hit_count << " hits" << std::endl;
+	}
+
+	static test_conformal_algebra instance;
+};
+#if USE_CURRENT_TEST
+test_conformal_algebra test_conformal_algebra::instance;
+#endif // #if USE_CURRENT_TEST
+} // namespace SBLib::Test
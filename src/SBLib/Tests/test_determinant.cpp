@@ -0,0 +1,112 @@
+#include <test_common.h>
+#include <Mathematics/determinant.h>
+#include <Mathematics/exterior_algebra.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#ifdef USE_CURRENT_TEST
+#undef USE_CURRENT_TEST
+#endif
+#define USE_CURRENT_TEST 1
+
+namespace SBLib::Test
+{
+class test_determinant : public RegisteredFunctor
+{
+	enum
+	{
+		e0 = (1 << 0), e1 = (1 << 1),
+		e2 = (1 << 2), e3 = (1 << 3),
+		e4 = (1 << 4), e5 = (1 << 5),
+		e6 = (1 << 6), e7 = (1 << 7),
+	};
+	using vector_type3 = vector_t<float, e0 | e1 | e2>;
+	using vector_type4 = vector_t<double, e0 | e1 | e2 | e3>;
+	using vector_type8 = vector_t<double, e0 | e1 | e2 | e3 | e4 | e5 | e6 | e7>;
+
+	test_determinant() : RegisteredFunctor(__FUNCTION__, fct) {}
+	static void fct()
+	{
+		std::mt19937 generator(0);
+		std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+		auto random = [&]() { return distribution(generator); };
+
+		vector_type3 u{ random(), random(), random() };
+		vector_type3 v{ random(), random(), random() };
+		vector_type3 w{ random(), random(), random() };
+		std::cout << "Det{" << u << v << w << "}" << std::endl
+			<< "\t= " << *(u ^ v ^ w) << " (wedge + hodge)" << std::endl
+			<< "\t= " << wedge_all(u, v, w) << " (wedge_all)" << std::endl
+			<< "\t= " << determinant(u, v, w) << " (determinant)" << std::endl;
+		std::cout << "u ^ v = " << (u ^ v) << " ~ " << wedge_all(u, v) << std::endl;
+
+		vector_type4 a{ 2.0, 0.0, 0.0, 0.0 }, b{ 0.0, 3.0, 0.0, 0.0 }, c{ 0.0, 0.0, 5.0, 0.0 }, d{ 1.0, 1.0, 1.0, 7.0 };
+		std::cout << "Det(diag(2, 3, 5, 7)) = " << determinant(a, b, c, d) << " ~ " << wedge_all(a, b, c, d) << std::endl;
+
+		vector_type8 x0{ 1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 }, x1{ 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+		vector_type8 x2{ 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 0.0 }, x3{ 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0 };
+		vector_type8 x4{ 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0 }, x5{ 0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0 };
+		vector_type8 x6{ 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0 }, x7{ 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0 };
+		std::cout << "Det(e0, ..., e5, e7, e6) = " << determinant(x0, x1, x2, x3, x4, x5, x6, x7) << std::endl;
+
+		//
+		// batch : orientation of many triangles in the plane and determinants of many 3x3 matrices
+		//
+		enum : size_t { batch_size = (1 << 20), };
+		std::vector<float> streams[9];
+		for (auto& stream : streams)
+		{
+			stream.resize(batch_size);
+			for (auto& value : stream)
+				value = random();
+		}
+		std::vector<float> results(batch_size);
+		vector_soa_t<float, e0 | e1 | e2> rows[3] = {
+			{ { streams[0].data(), streams[1].data(), streams[2].data() }, batch_size },
+			{ { streams[3].data(), streams[4].data(), streams[5].data() }, batch_size },
+			{ { streams[6].data(), streams[7].data(), streams[8].data() }, batch_size },
+		};
+
+		const auto start_batch = std::chrono::high_resolution_clock::now();
+		determinant(results.data(), rows[0], rows[1], rows[2]);
+		const auto end_batch = std::chrono::high_resolution_clock::now();
+
+		float max_error = 0.0f;
+		const auto start_wedge = std::chrono::high_resolution_clock::now();
+		for (size_t index = 0; index < batch_size; ++index)
+		{
+			const float value = (*(rows[0].load(index) ^ rows[1].load(index) ^ rows[2].load(index))).components[0];
+			max_error = std::max(max_error, std::abs(value - results[index]));
+		}
+		const auto end_wedge = std::chrono::high_resolution_clock::now();
+		std::cout << batch_size << " determinants : "
+			<< std::chrono::duration<double, std::milli>(end_batch - start_batch).count() << "ms (batch) vs "
+			<< std::chrono::duration<double, std::milli>(end_wedge - start_wedge).count() << "ms (wedge + hodge), max error " << max_error << std::endl;
+
+		std::vector<int> signs(batch_size);
+		vector_soa_t<float, e0 | e1> points[3] = {
+			{ { streams[0].data(), streams[1].data() }, batch_size },
+			{ { streams[2].data(), streams[3].data() }, batch_size },
+			{ { streams[4].data(), streams[5].data() }, batch_size },
+		};
+		const auto start_orientation = std::chrono::high_resolution_clock::now();
+		orientation(signs.data(), points[0], points[1], points[2]);
+		const auto end_orientation = std::chrono::high_resolution_clock::now();
+		size_t positive_count = 0;
+		for (const int sign : signs)
+			positive_count += (sign > 0) ? 1 : 0;
+		std::cout << batch_size << " orientation tests : "
+			<< std::chrono::duration<double, std::milli>(end_orientation - start_orientation).count() << "ms, "
+			<< positive_count << " positive" << std::endl;
+	}
+
+	static test_determinant instance;
+};
+#if USE_CURRENT_TEST
+test_determinant test_determinant::instance;
+#endif // #if USE_CURRENT_TEST
+} // namespace SBLib::Test
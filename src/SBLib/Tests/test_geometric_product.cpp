@@ -0,0 +1,66 @@
+#include <test_common.h>
+#include <Mathematics/exterior_algebra.h>
+#include <Mathematics/geometric_product.h>
+#include <Mathematics/sandwich.h>
+
+#include <cmath>
+
+#ifdef USE_CURRENT_TEST
+#undef USE_CURRENT_TEST
+#endif
+#define USE_CURRENT_TEST 1
+
+namespace SBLib::Test
+{
+class test_geometric_product : public RegisteredFunctor
+{
+	enum
+	{
+		e0 = (1 << 0), e1 = (1 << 1),
+		e2 = (1 << 2), e3 = (1 << 3),
+		e4 = (1 << 4),
+	};
+	using vector_type   = vector_t<double, e0 | e1 | e2 | e3>;
+	using bivector_type = multivector_t<double, e0 | e1 | e2 | e3, 2>;
+	using scalar_type   = multivector_t<double, e0 | e1 | e2 | e3, 0>;
+
+	test_geometric_product() : RegisteredFunctor(__FUNCTION__, fct) {}
+	static void fct()
+	{
+		const vector_type u{ 1.0, 2.0, 3.0, 4.0 };
+		const vector_type v{ -1.0, 0.5, 0.0, 2.0 };
+
+		// u v = u . v + u ^ v, for each signature
+		const auto euclidian  = geometric_product(u, v);
+		const auto spacetime  = geometric_product<spacetime_metric>(u, v);
+		const auto projective = geometric_product<projective_metric>(u, v);
+		std::cout << "u v (4, 0, 0) = " << std::get<0>(euclidian)  << " + " << std::get<1>(euclidian)  << " ~ u ^ v = " << (u ^ v) << std::endl;
+		std::cout << "u v (1, 3, 0) = " << std::get<0>(spacetime)  << " + " << std::get<1>(spacetime)  << std::endl;
+		std::cout << "u v (3, 0, 1) = " << std::get<0>(projective) << " + " << std::get<1>(projective) << std::endl;
+
+		// e3 is null in PGA : its square vanishes and so does its metric Hodge dual
+		const vector_type n{ 0.0, 0.0, 0.0, 1.0 };
+		std::cout << "e3 e3 (3, 0, 1) = " << std::get<0>(geometric_product<projective_metric>(n, n)) << std::endl;
+		std::cout << "*e3 (3, 0, 1) = " << hodge_conjugate<projective_metric>(n) << " vs *e3 (4, 0, 0) = " << hodge_conjugate(n) << std::endl;
+
+		// Lorentz boost along e1 : B = cosh(phi / 2) + sinh(phi / 2) (e0 ^ e1), keeps the spacetime interval
+		const double phi = 0.75;
+		bivector_type generator;
+		generator.get<e0 | e1>() = std::sinh(0.5 * phi);
+		const versor_t<double, e0 | e1 | e2 | e3, 0, 2> boost{ scalar_type{ std::cosh(0.5 * phi) }, generator };
+		const vector_type t{ 1.0, 0.0, 0.0, 0.0 };
+		const vector_type boosted = sandwich<spacetime_metric>(boost, t);
+		std::cout << "B e0 B~ = " << boosted << " ~ (" << std::cosh(phi) << ", " << -std::sinh(phi) << ", 0, 0)" << std::endl;
+		std::cout << "interval = " << std::get<0>(geometric_product<spacetime_metric>(boosted, boosted)) << std::endl;
+
+		// rotor composition in the even subalgebra
+		const auto composed = geometric_product<spacetime_metric>(boost, boost);
+		std::cout << "B B = " << std::get<0>(composed) << " + " << std::get<1>(composed) << " + " << std::get<2>(composed) << std::endl;
+	}
+
+	static test_geometric_product instance;
+};
+#if USE_CURRENT_TEST
+test_geometric_product test_geometric_product::instance;
+#endif // #if USE_CURRENT_TEST
+} // namespace SBLib::Test
@@ -0,0 +1,101 @@
+#include <test_common.h>
+#include <Mathematics/graded_multivector.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#ifdef USE_CURRENT_TEST
+#undef USE_CURRENT_TEST
+#endif
+#define USE_CURRENT_TEST 1
+
+namespace SBLib::Test
+{
+class test_graded_multivector : public RegisteredFunctor
+{
+	enum
+	{
+		e0 = (1 << 0), e1 = (1 << 1),
+		e2 = (1 << 2), e3 = (1 << 3),
+	};
+	enum : size_t
+	{
+		grade0 = (1 << 0), grade1 = (1 << 1),
+		grade2 = (1 << 2), grade3 = (1 << 3),
+		grade4 = (1 << 4),
+	};
+	using rotor_type  = graded_multivector_t<float, e0 | e1 | e2, grade0 | grade2>;
+	using vector_type = graded_multivector_t<float, e0 | e1 | e2, grade1>;
+	using motor_type  = graded_multivector_t<float, e0 | e1 | e2 | e3, grade0 | grade2 | grade4>;
+
+	// grade sets are propagated at compile time
+	static_assert(decltype(std::declval<rotor_type>() * std::declval<rotor_type>())::grade_mask == (grade0 | grade2), "Rotors are closed under the geometric product.");
+	static_assert(decltype(std::declval<rotor_type>() * std::declval<vector_type>())::grade_mask == (grade1 | grade3), "A rotor times a vector is a vector plus a trivector.");
+	static_assert(decltype(std::declval<vector_type>() ^ std::declval<vector_type>())::grade_mask == grade2, "The wedge of two vectors is a bivector.");
+	static_assert(decltype(std::declval<vector_type>() + std::declval<rotor_type>())::grade_mask == (grade0 | grade1 | grade2), "Sums hold the union of the grades.");
+	static_assert(rotor_type::dimension_size == 4 && motor_type::dimension_size == 8, "Only the selected grades are stored.");
+
+	test_graded_multivector() : RegisteredFunctor(__FUNCTION__, fct) {}
+	static void fct()
+	{
+		// rotation of 90 degrees in the e0 ^ e1 plane
+		rotor_type R;
+		R.get<0>()       = std::cos(0.7853982f);
+		R.get<e0 | e1>() = -std::sin(0.7853982f);
+		vector_type x;
+		x.get<e0>() = 1.0f;
+		const auto rotated = grade_projection<grade1>(R * x * reverse(R));
+		std::cout << "R (1, 0, 0) R~ = " << rotated.get_part<1>() << " ~ (0, 1, 0), trivector part " << (R * x * reverse(R)).get_part<3>() << std::endl;
+
+		vector_type y;
+		y.get<e1>() = 1.0f;
+		std::cout << "x ^ y = " << (x ^ y).get_part<2>() << ", x y = " << (x * y).get_part<0>() << " + " << (x * y).get_part<2>() << std::endl;
+
+		//
+		// contiguous products against the separate-grade versor_t products
+		//
+		std::mt19937 generator(0);
+		std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+		enum : size_t { batch_size = (1 << 18), };
+		std::vector<motor_type> motors(batch_size);
+		std::vector<motor_type::versor_type> versors(batch_size);
+		for (size_t index = 0; index < batch_size; ++index)
+		{
+			for (size_t component = 0; component < motor_type::dimension_size; ++component)
+				motors[index].components[component] = distribution(generator);
+			versors[index] = motors[index].to_versor();
+		}
+
+		std::vector<motor_type> graded_results(batch_size - 1);
+		const auto start_graded = std::chrono::high_resolution_clock::now();
+		for (size_t index = 0; index + 1 < batch_size; ++index)
+			graded_results[index] = motors[index] * motors[index + 1];
+		const auto end_graded = std::chrono::high_resolution_clock::now();
+
+		std::vector<motor_type::versor_type> versor_results(batch_size - 1);
+		const auto start_versor = std::chrono::high_resolution_clock::now();
+		for (size_t index = 0; index + 1 < batch_size; ++index)
+			versor_results[index] = geometric_product(versors[index], versors[index + 1]);
+		const auto end_versor = std::chrono::high_resolution_clock::now();
+
+		float max_error = 0.0f;
+		for (size_t index = 0; index + 1 < batch_size; ++index)
+		{
+			const motor_type reference(versor_results[index]);
+			for (size_t component = 0; component < motor_type::dimension_size; ++component)
+				max_error = std::max(max_error, std::abs(graded_results[index].components[component] - reference.components[component]));
+		}
+		std::cout << (batch_size - 1) << " 4-D even products : "
+			<< std::chrono::duration<double, std::milli>(end_graded - start_graded).count() << "ms (graded) vs "
+			<< std::chrono::duration<double, std::milli>(end_versor - start_versor).count() << "ms (versor_t), max error " << max_error << std::endl;
+	}
+
+	static test_graded_multivector instance;
+};
+#if USE_CURRENT_TEST
+test_graded_multivector test_graded_multivector::instance;
+#endif // #if USE_CURRENT_TEST
+} // namespace SBLib::Test
@@ -0,0 +1,80 @@
+#include <test_common.h>
+#include <Mathematics/exterior_algebra.h>
+#include <Mathematics/runtime_algebra.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+
+#ifdef USE_CURRENT_TEST
+#undef USE_CURRENT_TEST
+#endif
+#define USE_CURRENT_TEST 1
+
+namespace SBLib::Test
+{
+class test_high_dimension : public RegisteredFunctor
+{
+	enum : size_t
+	{
+		space_mask_64  = ~size_t(0),
+		space_mask_odd = size_t(0xAAAAAAAAAAAAAAAAull), // 32-D, odd bits of a 64-bit mask
+	};
+
+	// largest deviation of u ^ v from u_i v_j - u_j v_i, reading the bivector through the runtime blade ranking
+	template<size_t space_mask, typename scalar_t>
+	static double get_wedge_error(const multivector_t<scalar_t, space_mask, 2>& B, const vector_t<scalar_t, space_mask>& u, const vector_t<scalar_t, space_mask>& v)
+	{
+		double error = 0.0;
+		for (size_t i = 0; i < u.dimension_size; ++i)
+			for (size_t j = i + 1; j < u.dimension_size; ++j)
+			{
+				const size_t blade = unrank_blade(space_mask, 1, i) | unrank_blade(space_mask, 1, j);
+				const double expected = double(u.components[i]) * double(v.components[j]) - double(u.components[j]) * double(v.components[i]);
+				error = std::max(error, std::abs(double(B.components[rank_blade(space_mask, blade)]) - expected));
+			}
+		return error;
+	}
+
+	test_high_dimension() : RegisteredFunctor(__FUNCTION__, fct) {}
+	static void fct()
+	{
+		std::mt19937 generator(0);
+		std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+
+		//
+		// 64-D vectors and bivectors
+		//
+		vector_t<double, space_mask_64> u, v;
+		for (size_t index = 0; index < u.dimension_size; ++index)
+		{
+			u.components[index] = distribution(generator);
+			v.components[index] = distribution(generator);
+		}
+		const auto start_wedge = std::chrono::high_resolution_clock::now();
+		const auto B = u ^ v;
+		const auto end_wedge = std::chrono::high_resolution_clock::now();
+		std::cout << "64-D u ^ v : " << B.dimension_size << " components in " << std::chrono::duration<double, std::micro>(end_wedge - start_wedge).count()
+			<< "us, error " << get_wedge_error(B, u, v) << std::endl;
+		std::cout << "64-D (u ^ v).get<e0 ^ e63>() = " << B.get<(size_t(1) << 0) | (size_t(1) << 63)>() << " ~ "
+			<< u.get<(size_t(1) << 0)>() * v.get<(size_t(1) << 63)>() - u.get<(size_t(1) << 63)>() * v.get<(size_t(1) << 0)>() << std::endl;
+
+		//
+		// 32-D vectors over the odd bits of a 64-bit mask
+		//
+		vector_t<float, space_mask_odd> a, b;
+		for (size_t index = 0; index < a.dimension_size; ++index)
+		{
+			a.components[index] = float(distribution(generator));
+			b.components[index] = float(distribution(generator));
+		}
+		std::cout << "32-D (odd bits) a ^ b : " << (a ^ b).dimension_size << " components, error " << get_wedge_error(a ^ b, a, b) << std::endl;
+	}
+
+	static test_high_dimension instance;
+};
+#if USE_CURRENT_TEST
+test_high_dimension test_high_dimension::instance;
+#endif // #if USE_CURRENT_TEST
+} // namespace SBLib::Test
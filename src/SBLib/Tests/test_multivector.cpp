@@ -1,5 +1,5 @@
 #include <test_common.h>
-#include <Traits/clifford_traits.h>
+#include <Mathematics/exterior_algebra.h>
 
 #include <fstream>
 
@@ -13,58 +13,6 @@
 
 namespace SBLib::Mathematics
 {
-//
-// Wedge product
-//
-template<size_t subspace_mask, size_t loop>
-struct wedge_product_helper
-{
-private:
-	template<size_t subspace_mask2, size_t loop2>
-	struct wedge_product_internal
-	{
-		template<typename scalar_t>
-		struct assign
-		{
-			template<int sign> static constexpr void alternate_multiply(scalar_t, const scalar_t&, const scalar_t&) {}; // nothing to do
-		};
-		template<typename scalar_t>
-		struct assign<scalar_t&>
-		{
-			template<int sign> static constexpr void alternate_multiply    (scalar_t& result, const scalar_t& u, const scalar_t& v); // should not be called
-			template<>         static constexpr void alternate_multiply<+1>(scalar_t& result, const scalar_t& u, const scalar_t& v) { result += u * v; }
-			template<>         static constexpr void alternate_multiply<-1>(scalar_t& result, const scalar_t& u, const scalar_t& v) { result -= u * v; }
-		};
-
-	public:
-		template<typename scalar_t, size_t space_mask0, size_t space_mask2, size_t rank_size0, size_t rank_size2>
-		wedge_product_internal(multivector_t<scalar_t, space_mask0, rank_size0>& result, const scalar_t& u, const multivector_t<scalar_t, space_mask2, rank_size2>& v)
-		{
-			using traits = SBLib::alternating_traits<subspace_mask, subspace_mask2>;
-			using ref_type = decltype( result.get<(subspace_mask ^ subspace_mask2)>() );
-			assign<ref_type>::alternate_multiply<traits::sign>(result.get<(subspace_mask ^ subspace_mask2)>(), u, v.get<subspace_mask2>());
-		}
-	};
-
-public:
-	template<typename scalar_t, size_t space_mask0, size_t space_mask1, size_t space_mask2, size_t rank_size0, size_t rank_size1, size_t rank_size2>
-	wedge_product_helper(multivector_t<scalar_t, space_mask0, rank_size0>& result, const multivector_t<scalar_t, space_mask1, rank_size1>& u, const multivector_t<scalar_t, space_mask2, rank_size2>& v)
-	{
-		SBLib::for_each_combination< SBLib::select_combinations<space_mask2, rank_size2> >::iterate<wedge_product_internal>(result, u.get<subspace_mask>(), v);
-	}
-};
-//
-// Generic version
-//
-template<typename scalar_t, size_t space_mask1, size_t space_mask2, size_t rank_size1, size_t rank_size2>
-auto wedge_product(const multivector_t<scalar_t, space_mask1, rank_size1>& u, const multivector_t<scalar_t, space_mask2, rank_size2>& v)
-{
-	using multivec_t = multivector_t<scalar_t, (space_mask1 | space_mask2), (rank_size1 + rank_size2)>;
-	multivec_t result;
-	SBLib::for_each_combination< SBLib::select_combinations<space_mask1, rank_size1> >::iterate<wedge_product_helper>(result, u, v);
-	return std::move(result);
-}
-
 #if USE_DIRECTX_VECTOR_HACK
 //
 // HACK ALERT : temporary test code for optimization check.
@@ -97,56 +45,6 @@ auto wedge_product(const vector_t<float, space_mask>& u, const vector_t<float, s
 	return std::move(*result);
 }
 #endif // #if USE_DIRECTX_VECTOR
-template<typename scalar_t, size_t space_mask1, size_t space_mask2, size_t rank_size1, size_t rank_size2>
-auto operator ^(const multivector_t<scalar_t, space_mask1, rank_size1>& u, const multivector_t<scalar_t, space_mask2, rank_size2>& v)
-{
-	return std::move(wedge_product(u, v));
-}
-
-
-//
-// Hodge dual
-//
-template<size_t subspace_mask, size_t loop>
-struct hodge_conjugate_helper
-{
-private:
-	using scalar_t = float;
-	template<typename scalar_t>
-	struct assign
-	{
-		template<int sign> static constexpr void conjugate(scalar_t, const scalar_t&) {}; // result is not in destination space : nothing to do
-	};
-	template<typename scalar_t>
-	struct assign<scalar_t&>
-	{
-		template<int sign> static constexpr void conjugate(scalar_t& result, const scalar_t& u); // should not be called ever
-		template<>         static constexpr void conjugate<+1>(scalar_t& result, const scalar_t& u) { result = +u; }
-		template<>         static constexpr void conjugate<-1>(scalar_t& result, const scalar_t& u) { result = -u; }
-	};
-
-public:
-	template<typename scalar_t, size_t space_mask0, size_t space_mask1, size_t rank_size0, size_t rank_size1>
-	hodge_conjugate_helper(multivector_t<scalar_t, space_mask0, rank_size0>& result, const multivector_t<scalar_t, space_mask1, rank_size1>& u)
-	{
-		using traits = SBLib::hodge_conjugacy_traits<subspace_mask, space_mask0>;
-		using ref_type = decltype(result.get<traits::bit_set>());
-		static_assert((subspace_mask & space_mask0) == subspace_mask, "Cannot calculate Hodge dual over non-embedding space. Please project onto target space first.");
-		static_assert((subspace_mask ^ traits::bit_set) == space_mask0, "Incorrect dual space.");
-		assign<ref_type>::conjugate<traits::sign>(result.get<traits::bit_set>(), u.get<subspace_mask>());
-	}
-};
-//
-// Generic version
-//
-template<typename scalar_t, size_t space_mask, size_t rank_size>
-auto hodge_conjugate(const multivector_t<scalar_t, space_mask, rank_size>& u)
-{
-	using multivec_t = multivector_t<scalar_t, space_mask, vector_t<scalar_t, space_mask>::dimension_size - rank_size>;
-	multivec_t result(multivec_t::UNINITIALIZED);
-	SBLib::for_each_combination< SBLib::select_combinations<space_mask, rank_size> >::iterate<hodge_conjugate_helper>(result, u);
-	return std::move(result);
-}
 
 #if USE_DIRECTX_VECTOR_HACK
 //
@@ -165,23 +63,6 @@ auto hodge_conjugate(const multivector_t<float, space_mask, rank_size>& u)
 	return std::move(result);
 }
 #endif // USE_DIRECTX_VECTOR
-template<typename scalar_t, size_t space_mask, size_t rank_size>
-auto operator *(const multivector_t<scalar_t, space_mask, rank_size>& u)
-{
-	return std::move(hodge_conjugate(u));
-}
-
-
-template<typename scalar_t, size_t space_mask1, size_t space_mask2, size_t rank_size1, size_t rank_size2>
-auto CrossProduct(const multivector_t<scalar_t, space_mask1, rank_size1>& u, const multivector_t<scalar_t, space_mask2, rank_size2>& v)
-{
-	return std::move( *(u ^ v) );
-}
-template<typename scalar_t, size_t space_mask1, size_t space_mask2, size_t rank_size1, size_t rank_size2>
-auto InnerProduct(const multivector_t<scalar_t, space_mask1, rank_size1>& u, const multivector_t<scalar_t, space_mask2, rank_size2>& v)
-{
-	return std::move( *(u ^ *v) );
-}
 } // namespace SBLib::Mathematics
 
 //////////////////////////////////////////////////////////////////////////////
@@ -295,6 +176,9 @@ class test_multivector : public RegisteredFunctor
 		auto test7 = (test1 ^ test2 ^ test3);
 		std::cout << "Det{" << test1 << test2 << test3 << "} = " << *test7 << std::endl;
 
+		auto test8 = (test1 ^ test3) & (test2 ^ test3);
+		std::cout << "(" << (test1 ^ test3) << ") & (" << (test2 ^ test3) << ") = " << test8 << " ~ " << *(*(test1 ^ test3) ^ *(test2 ^ test3)) << std::endl;
+
 		std::cout << "... run test '" << instance.get_id() << "d' to delete input file..." << std::endl;
 	}
 
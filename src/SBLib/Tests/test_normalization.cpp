@@ -0,0 +1,138 @@
+#include <test_common.h>
+#include <Mathematics/geometric_product.h>
+#include <Mathematics/normalization.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#ifdef USE_CURRENT_TEST
+#undef USE_CURRENT_TEST
+#endif
+#define USE_CURRENT_TEST 1
+
+namespace SBLib::Test
+{
+class test_normalization : public RegisteredFunctor
+{
+	enum : size_t
+	{
+		space_mask_3 = (1 << 3) - 1,
+		space_mask_4 = (1 << 4) - 1,
+	};
+	using rotor_type = versor_t<float, space_mask_3, 0, 2>;
+
+	// largest deviation of a mixed-grade product from the scalar 1
+	template<typename versor_type>
+	static double get_identity_error(const versor_type& versor)
+	{
+		double error = std::abs(double(get_scalar_part(versor)) - 1.0);
+		std::apply([&](const auto&... parts)
+		{
+			auto get_part_error = [&](const auto& part)
+			{
+				if (std::decay_t<decltype(part)>::rank_size > 0)
+					for (size_t index = 0; index < std::decay_t<decltype(part)>::dimension_size; ++index)
+						error = std::max(error, double(std::abs(part.components[index])));
+			};
+			(get_part_error(parts), ...);
+		}, versor);
+		return error;
+	}
+	template<typename versor_type, typename generator_type>
+	static void set_random(versor_type& versor, generator_type& generator)
+	{
+		std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+		std::apply([&](auto&... parts)
+		{
+			auto set_part = [&](auto& part)
+			{
+				for (size_t index = 0; index < std::decay_t<decltype(part)>::dimension_size; ++index)
+					part.components[index] = distribution(generator);
+			};
+			(set_part(parts), ...);
+		}, versor);
+	}
+
+	test_normalization() : RegisteredFunctor(__FUNCTION__, fct) {}
+	static void fct()
+	{
+		std::mt19937 generator(0);
+		std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+		// operator / on multivectors
+		const vector_t<float, space_mask_3> u{ 2.0f, 4.0f, 6.0f };
+		std::cout << "(2, 4, 6) / 2 = " << (u / 2.0f) << std::endl;
+
+		//
+		// rotor drift : compose many small rotations, then renormalize and invert
+		//
+		multivector_t<float, space_mask_3, 2> step_plane;
+		for (size_t index = 0; index < step_plane.dimension_size; ++index)
+			step_plane.components[index] = 0.01f * distribution(generator);
+		const rotor_type step = normalize(rotor_type{ multivector_t<float, space_mask_3, 0>{ 1.0f }, step_plane });
+		rotor_type R{ multivector_t<float, space_mask_3, 0>{ 1.0f }, multivector_t<float, space_mask_3, 2>{} };
+		for (size_t index = 0; index < 100000; ++index)
+			R = geometric_product(R, step);
+		std::cout << "|R|^2 after 100000 compositions : " << norm_squared(R) << ", after normalize : " << norm_squared(normalize(R)) << std::endl;
+		std::cout << "R inverse(R) - 1 : " << get_identity_error(geometric_product(R, inverse(R))) << std::endl;
+
+		//
+		// general inverse of arbitrary multivectors in 3-D and 4-D (double precision)
+		//
+		versor_t<double, space_mask_3, 0, 1, 2, 3> x3;
+		versor_t<double, space_mask_4, 0, 1, 2, 3, 4> x4;
+		set_random(x3, generator);
+		set_random(x4, generator);
+		std::cout << "3-D x general_inverse(x) - 1 : " << get_identity_error(geometric_product(x3, general_inverse(x3))) << std::endl;
+		std::cout << "4-D x general_inverse(x) - 1 : " << get_identity_error(geometric_product(x4, general_inverse(x4))) << std::endl;
+
+		//
+		// batch : renormalize 3-D float rotors in place, packed rsqrt against sqrt and division
+		//
+		enum : size_t { batch_size = (1 << 22), };
+		std::vector<float> streams[4];
+		for (auto& stream : streams)
+		{
+			stream.resize(batch_size);
+			for (auto& value : stream)
+				value = distribution(generator);
+		}
+		const versor_soa_t<float, space_mask_3, 0, 2> rotors{
+			multivector_soa_t<float, space_mask_3, 0>{ { streams[0].data() }, batch_size },
+			multivector_soa_t<float, space_mask_3, 2>{ { streams[1].data(), streams[2].data(), streams[3].data() }, batch_size },
+		};
+		std::vector<float> reference[4] = { streams[0], streams[1], streams[2], streams[3] };
+
+		const auto start_batch = std::chrono::high_resolution_clock::now();
+		normalize(rotors, rotors);
+		const auto end_batch = std::chrono::high_resolution_clock::now();
+
+		const auto start_reference = std::chrono::high_resolution_clock::now();
+		for (size_t index = 0; index < batch_size; ++index)
+		{
+			const float norm = std::sqrt(reference[0][index] * reference[0][index] + reference[1][index] * reference[1][index] + reference[2][index] * reference[2][index] + reference[3][index] * reference[3][index]);
+			for (auto& stream : reference)
+				stream[index] /= norm;
+		}
+		const auto end_reference = std::chrono::high_resolution_clock::now();
+
+		float max_error = 0.0f;
+		for (size_t component = 0; component < 4; ++component)
+			for (size_t index = 0; index < batch_size; ++index)
+				max_error = std::max(max_error, std::abs(streams[component][index] - reference[component][index]));
+		std::cout << batch_size << " rotors normalized : " << std::chrono::duration<double, std::milli>(end_batch - start_batch).count() << "ms (rsqrt) vs "
+			<< std::chrono::duration<double, std::milli>(end_reference - start_reference).count() << "ms (sqrt and division), max error " << max_error << std::endl;
+
+		inverse(rotors, rotors);
+		std::cout << "inverse of a unit rotor is its reverse : " << streams[0][0] << " " << streams[1][0] << " ~ " << reference[0][0] << " " << -reference[1][0] << std::endl;
+	}
+
+	static test_normalization instance;
+};
+#if USE_CURRENT_TEST
+test_normalization test_normalization::instance;
+#endif // #if USE_CURRENT_TEST
+} // namespace SBLib::Test
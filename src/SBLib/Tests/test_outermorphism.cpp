@@ -0,0 +1,59 @@
+#include <test_common.h>
+#include <Mathematics/exterior_algebra.h>
+#include <Mathematics/outermorphism.h>
+
+#include <cmath>
+#include <vector>
+
+#ifdef USE_CURRENT_TEST
+#undef USE_CURRENT_TEST
+#endif
+#define USE_CURRENT_TEST 1
+
+namespace SBLib::Test
+{
+class test_outermorphism : public RegisteredFunctor
+{
+	enum
+	{
+		e0 = (1 << 0), e1 = (1 << 1),
+		e2 = (1 << 2), e3 = (1 << 3),
+	};
+	using vector_type     = vector_t<float, e0 | e1 | e2>;
+	using bivector_type   = multivector_t<float, e0 | e1 | e2, 2>;
+	using linear_map_type = linear_map_t<float, e0 | e1 | e2>;
+
+	test_outermorphism() : RegisteredFunctor(__FUNCTION__, fct) {}
+	static void fct()
+	{
+		const float angle = 0.4f;
+		const linear_map_type f{ {
+			vector_type{ 2.0f * std::cos(angle), std::sin(angle), 0.0f },
+			vector_type{ -std::sin(angle), std::cos(angle), 0.0f },
+			vector_type{ 0.0f, 1.0f, 3.0f },
+		} };
+		const auto f2 = outermorphism<2>(f);
+		const auto f3 = outermorphism(f2, f);
+
+		const vector_type u{ 1.0f, 2.0f, 3.0f };
+		const vector_type v{ -1.0f, 0.5f, 0.25f };
+		const vector_type w{ 0.0f, 1.0f, -1.0f };
+		std::cout << "f(u) ^ f(v)      = " << (f(u) ^ f(v)) << std::endl;
+		std::cout << "f2(u ^ v)        = " << f2(u ^ v) << std::endl;
+		std::cout << "f(u) ^ f(v) ^ f(w) = " << (f(u) ^ f(v) ^ f(w)) << std::endl;
+		std::cout << "f3(u ^ v ^ w)      = " << f3(u ^ v ^ w) << std::endl;
+		std::cout << "det f = " << f3.columns[0] << " ~ " << determinant(f.columns[0], f.columns[1], f.columns[2]) << std::endl;
+
+		// bivector field transformed by the same map
+		std::vector<bivector_type> field(1024, bivector_type{ 1.0f, 2.0f, 3.0f });
+		std::vector<bivector_type> transformed(field.size());
+		apply(f2, transformed.data(), field.data(), field.size());
+		std::cout << "f2(field[0]) = " << transformed[0] << std::endl;
+	}
+
+	static test_outermorphism instance;
+};
+#if USE_CURRENT_TEST
+test_outermorphism test_outermorphism::instance;
+#endif // #if USE_CURRENT_TEST
+} // namespace SBLib::Test
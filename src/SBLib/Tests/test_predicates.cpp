@@ -0,0 +1,73 @@
+#include <test_common.h>
+#include <Mathematics/predicates.h>
+
+#include <cmath>
+
+#ifdef USE_CURRENT_TEST
+#undef USE_CURRENT_TEST
+#endif
+#define USE_CURRENT_TEST 1
+
+namespace SBLib::Test
+{
+class test_predicates : public RegisteredFunctor
+{
+	enum
+	{
+		e0 = (1 << 0), e1 = (1 << 1),
+		e2 = (1 << 2), e3 = (1 << 3),
+	};
+	using point2_t = vector_t<float, e0 | e1>;
+	using point3_t = vector_t<double, e0 | e1 | e2>;
+
+	test_predicates() : RegisteredFunctor(__FUNCTION__, fct) {}
+	static void fct()
+	{
+		//
+		// Classic near-degenerate orientation grid : p = (0.5 + i * ulp, 0.5 + j * ulp) against the line through (12, 12) and (24, 24).
+		// Every point of the grid diagonal is exactly on the line; the naive float orientation is not even consistent with that.
+		//
+		const point2_t q{ 12.0f, 12.0f };
+		const point2_t r{ 24.0f, 24.0f };
+		enum : int { grid_size = 32, };
+		int naive_errors = 0, exact_errors = 0;
+		for (int j = grid_size - 1; j >= 0; --j)
+		{
+			std::string naive_row, exact_row;
+			for (int i = 0; i < grid_size; ++i)
+			{
+				const float x = std::nextafter(0.5f, 1.0f) - 0.5f;
+				const point2_t p{ 0.5f + i * x, 0.5f + j * x };
+				const int expected = (i == j) ? 0 : (i < j) ? +1 : -1;
+				const int naive_sign = orientation(p, q, r);
+				const int exact_sign = orient(p, q, r);
+				naive_errors += (naive_sign != expected) ? 1 : 0;
+				exact_errors += (exact_sign != expected) ? 1 : 0;
+				naive_row += "-0+"[naive_sign + 1];
+				exact_row += "-0+"[exact_sign + 1];
+			}
+			std::cout << naive_row << "   " << exact_row << std::endl;
+		}
+		std::cout << "orientation (float) errors : " << naive_errors << ", orient (adaptive) errors : " << exact_errors << std::endl;
+
+		//
+		// Cospherical points : the four points lie on the unit sphere and the query is exactly on it too.
+		//
+		const point3_t a{ 1.0, 0.0, 0.0 }, b{ 0.0, 1.0, 0.0 }, c{ 0.0, 0.0, 1.0 }, d{ -1.0, 0.0, 0.0 };
+		const point3_t on{ 0.0, -1.0, 0.0 }, in{ 0.0, 0.0, 0.0 }, out{ 2.0, 2.0, 2.0 };
+		std::cout << "orient(a, b, c, d) = " << orient(a, b, c, d) << std::endl;
+		std::cout << "insphere(a, b, c, d, on/in/out) = " << insphere(a, b, c, d, on) << " " << insphere(a, b, c, d, in) << " " << insphere(a, b, c, d, out) << std::endl;
+
+		const point2_t u{ 1.0f, 0.0f }, v{ 0.0f, 1.0f }, w{ -1.0f, 0.0f };
+		std::cout << "incircle(u, v, w, (0, -1)/(0, 0)/(2, 2)) = "
+			<< incircle(u, v, w, point2_t{ 0.0f, -1.0f }) << " "
+			<< incircle(u, v, w, point2_t{ 0.0f, 0.0f }) << " "
+			<< incircle(u, v, w, point2_t{ 2.0f, 2.0f }) << std::endl;
+	}
+
+	static test_predicates instance;
+};
+#if USE_CURRENT_TEST
+test_predicates test_predicates::instance;
+#endif // #if USE_CURRENT_TEST
+} // namespace SBLib::Test
@@ -0,0 +1,148 @@
+#include <test_common.h>
+#include <Mathematics/projective_algebra.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#ifdef USE_CURRENT_TEST
+#undef USE_CURRENT_TEST
+#endif
+#define USE_CURRENT_TEST 1
+
+namespace SBLib::Test
+{
+class test_projective_algebra : public RegisteredFunctor
+{
+	enum
+	{
+		e0 = (1 << 0), e1 = (1 << 1),
+		e2 = (1 << 2), e3 = (1 << 3),
+	};
+	using motor_type = pga_motor_t<float>;
+	using point_type = pga_point_t<float>;
+	using line_type  = pga_line_t<float>;
+
+	test_projective_algebra() : RegisteredFunctor(__FUNCTION__, fct) {}
+	static void fct()
+	{
+		// rotation of 90 degrees around the z axis (e0 ^ e1 through the origin) followed by a translation
+		line_type z_axis;
+		z_axis.get<e0 | e1>() = 1.0f;
+		const motor_type R = make_pga_rotor(1.5707963f, z_axis);
+		const motor_type T = make_pga_translator(1.0f, 2.0f, 3.0f);
+		const motor_type M = compose(T, R);
+		const point_type p = make_pga_point(1.0f, 0.0f, 0.0f);
+		std::cout << "T R (1, 0, 0) = " << get_pga_position(transform(M, p)) << " ~ (1, 3, 3)" << std::endl;
+		std::cout << "T R (x = 2) = " << transform(M, make_pga_plane(1.0f, 0.0f, 0.0f, -2.0f)) << std::endl;
+
+		// screw interpolation : half way between identity and M
+		const motor_type H = interpolate(make_pga_identity<float>(), M, 0.5f);
+		std::cout << "H H (1, 0, 0) = " << get_pga_position(transform(compose(H, H), p)) << std::endl;
+		const motor_type L = pga_exp(pga_log(M));
+		std::cout << "exp(log(M)) = " << std::get<0>(L) << std::get<1>(L) << std::get<2>(L) << " ~ " << std::get<0>(M) << std::get<1>(M) << std::get<2>(M) << std::endl;
+
+		//
+		// batch : one motor applied to a point cloud, against the equivalent 4x4 affine matrix
+		//
+		std::mt19937 generator(0);
+		std::uniform_real_distribution<float> distribution(-10.0f, 10.0f);
+		enum : size_t { batch_size = (1 << 20), };
+		std::vector<float> positions[3], streams[4], results[4];
+		for (auto& stream : positions)
+		{
+			stream.resize(batch_size);
+			for (auto& value : stream)
+				value = distribution(generator);
+		}
+		for (size_t component = 0; component < 4; ++component)
+		{
+			streams[component].resize(batch_size);
+			results[component].resize(batch_size);
+		}
+		for (size_t index = 0; index < batch_size; ++index)
+		{
+			const point_type point = make_pga_point(positions[0][index], positions[1][index], positions[2][index]);
+			for (size_t component = 0; component < 4; ++component)
+				streams[component][index] = point.components[component];
+		}
+		const pga_point_soa_t<float> points{ { streams[0].data(), streams[1].data(), streams[2].data(), streams[3].data() }, batch_size };
+		const pga_point_soa_t<float> transformed{ { results[0].data(), results[1].data(), results[2].data(), results[3].data() }, batch_size };
+
+		const auto start_motor = std::chrono::high_resolution_clock::now();
+		transform(transformed, M, points);
+		const auto end_motor = std::chrono::high_resolution_clock::now();
+
+		// rows of the affine matrix are the images of the basis vectors and origin
+		const auto o  = get_pga_position(transform(M, make_pga_point(0.0f, 0.0f, 0.0f)));
+		const auto ex = get_pga_position(transform(M, make_pga_point(1.0f, 0.0f, 0.0f))) - o;
+		const auto ey = get_pga_position(transform(M, make_pga_point(0.0f, 1.0f, 0.0f))) - o;
+		const auto ez = get_pga_position(transform(M, make_pga_point(0.0f, 0.0f, 1.0f))) - o;
+		const float matrix[4][4] = {
+			{ ex.components[0], ey.components[0], ez.components[0], o.components[0] },
+			{ ex.components[1], ey.components[1], ez.components[1], o.components[1] },
+			{ ex.components[2], ey.components[2], ez.components[2], o.components[2] },
+			{ 0.0f, 0.0f, 0.0f, 1.0f },
+		};
+		std::vector<float> matrix_results[3];
+		for (auto& stream : matrix_results)
+			stream.resize(batch_size);
+		const auto start_matrix = std::chrono::high_resolution_clock::now();
+		for (size_t index = 0; index < batch_size; ++index)
+		{
+			const float x = positions[0][index], y = positions[1][index], z = positions[2][index];
+			for (size_t row = 0; row < 3; ++row)
+				matrix_results[row][index] = matrix[row][0] * x + matrix[row][1] * y + matrix[row][2] * z + matrix[row][3];
+		}
+		const auto end_matrix = std::chrono::high_resolution_clock::now();
+
+		float max_error = 0.0f;
+		for (size_t index = 0; index < batch_size; ++index)
+		{
+			const auto position = get_pga_position(transformed.load(index));
+			for (size_t row = 0; row < 3; ++row)
+				max_error = std::max(max_error, std::abs(position.components[row] - matrix_results[row][index]));
+		}
+		std::cout << batch_size << " points : "
+			<< std::chrono::duration<double, std::milli>(end_motor - start_motor).count() << "ms (motor) vs "
+			<< std::chrono::duration<double, std::milli>(end_matrix - start_matrix).count() << "ms (4x4 matrix), max error " << max_error << std::endl;
+
+		//
+		// batch : compositions of many motors (8 components, 48 products) against 4x4 matrix products (64 products)
+		//
+		enum : size_t { composition_count = (1 << 16), };
+		std::vector<motor_type> motors(composition_count);
+		for (size_t index = 0; index < composition_count; ++index)
+			motors[index] = compose(make_pga_translator(distribution(generator), distribution(generator), distribution(generator)), make_pga_rotor(0.1f * distribution(generator), z_axis));
+		motor_type accumulated = make_pga_identity<float>();
+		const auto start_compose = std::chrono::high_resolution_clock::now();
+		for (const auto& motor : motors)
+			accumulated = compose(motor, accumulated);
+		const auto end_compose = std::chrono::high_resolution_clock::now();
+
+		float accumulated_matrix[4][4] = { { 1.0f, 0.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, 0.0f, 1.0f } };
+		const auto start_product = std::chrono::high_resolution_clock::now();
+		for (size_t index = 0; index < composition_count; ++index)
+		{
+			float product[4][4];
+			for (size_t row = 0; row < 4; ++row)
+				for (size_t column = 0; column < 4; ++column)
+					product[row][column] = matrix[row][0] * accumulated_matrix[0][column] + matrix[row][1] * accumulated_matrix[1][column]
+					                     + matrix[row][2] * accumulated_matrix[2][column] + matrix[row][3] * accumulated_matrix[3][column];
+			std::copy(&product[0][0], &product[0][0] + 16, &accumulated_matrix[0][0]);
+		}
+		const auto end_product = std::chrono::high_resolution_clock::now();
+		std::cout << composition_count << " compositions : "
+			<< std::chrono::duration<double, std::milli>(end_compose - start_compose).count() << "ms (motors) vs "
+			<< std::chrono::duration<double, std::milli>(end_product - start_product).count() << "ms (4x4 matrices), "
+			<< std::get<0>(normalize(accumulated)) << " " << accumulated_matrix[3][3] << std::endl;
+	}
+
+	static test_projective_algebra instance;
+};
+#if USE_CURRENT_TEST
+test_projective_algebra test_projective_algebra::instance;
+#endif // #if USE_CURRENT_TEST
+} // namespace SBLib::Test
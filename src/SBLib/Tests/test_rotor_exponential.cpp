@@ -0,0 +1,150 @@
+#include <test_common.h>
+#include <Mathematics/geometric_product.h>
+#include <Mathematics/rotor_exponential.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#ifdef USE_CURRENT_TEST
+#undef USE_CURRENT_TEST
+#endif
+#define USE_CURRENT_TEST 1
+
+namespace SBLib::Test
+{
+class test_rotor_exponential : public RegisteredFunctor
+{
+	enum : size_t
+	{
+		space_mask_3 = (1 << 3) - 1,
+		space_mask_4 = (1 << 4) - 1,
+	};
+
+	template<typename type_t>
+	static float get_error(const type_t& u, const type_t& v)
+	{
+		float error = 0.0f;
+		for (size_t index = 0; index < type_t::dimension_size; ++index)
+			error = std::max(error, float(std::abs(u.components[index] - v.components[index])));
+		return error;
+	}
+
+	test_rotor_exponential() : RegisteredFunctor(__FUNCTION__, fct) {}
+	static void fct()
+	{
+		std::mt19937 generator(0);
+		std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+
+		//
+		// polynomial approximations against the standard library
+		//
+		double sin_error[3] = {}, atan2_error[3] = {};
+		for (size_t index = 0; index < 4096; ++index)
+		{
+			const double x = 8.0 * distribution(generator), y = distribution(generator);
+			sin_error[0] = std::max(sin_error[0], std::abs(approximate_sin<LOW_ACCURACY>(x) - std::sin(x)));
+			sin_error[1] = std::max(sin_error[1], std::abs(approximate_sin<MEDIUM_ACCURACY>(x) - std::sin(x)));
+			sin_error[2] = std::max(sin_error[2], std::abs(approximate_sin<HIGH_ACCURACY>(x) - std::sin(x)));
+			atan2_error[0] = std::max(atan2_error[0], std::abs(approximate_atan2<LOW_ACCURACY>(y, x) - std::atan2(y, x)));
+			atan2_error[1] = std::max(atan2_error[1], std::abs(approximate_atan2<MEDIUM_ACCURACY>(y, x) - std::atan2(y, x)));
+			atan2_error[2] = std::max(atan2_error[2], std::abs(approximate_atan2<HIGH_ACCURACY>(y, x) - std::atan2(y, x)));
+		}
+		std::cout << "sin error (low, medium, high) : " << sin_error[0] << ", " << sin_error[1] << ", " << sin_error[2] << std::endl;
+		std::cout << "atan2 error (low, medium, high) : " << atan2_error[0] << ", " << atan2_error[1] << ", " << atan2_error[2] << std::endl;
+
+		// large angles : the error should not grow with |x| up to ~1e5 (c.f., half_pi_split)
+		for (double range : { 1e2, 1e4, 1e5 })
+		{
+			float float_error = 0.0f;
+			double double_error = 0.0;
+			for (size_t index = 0; index < 4096; ++index)
+			{
+				const double x = range * distribution(generator);
+				float sine, cosine;
+				approximate_sin_cos(float(x), sine, cosine);
+				float_error  = std::max(float_error, float(std::max(std::abs(sine - std::sin(double(float(x)))), std::abs(cosine - std::cos(double(float(x)))))));
+				double_error = std::max(double_error, std::abs(approximate_sin(x) - std::sin(x)));
+			}
+			std::cout << "|x| <= " << range << " : sin / cos error " << float_error << " (float), sin error " << double_error << " (double)" << std::endl;
+		}
+
+		//
+		// 3-D : log(exp(B)) = B for |B| < pi
+		//
+		multivector_t<double, space_mask_3, 2> B3;
+		for (size_t index = 0; index < B3.dimension_size; ++index)
+			B3.components[index] = distribution(generator);
+		const auto R3 = rotor_exp(B3);
+		std::cout << "3-D exp(B) = " << std::get<0>(R3) << " + " << std::get<1>(R3) << ", log(exp(B)) error " << get_error(rotor_log(R3), B3) << std::endl;
+
+		//
+		// 4-D : B = B1 + B2 with commuting simple parts, exp(B) = exp(B1) exp(B2) and log(exp(B)) = B
+		//
+		multivector_t<double, space_mask_4, 2> B4;
+		for (size_t index = 0; index < B4.dimension_size; ++index)
+			B4.components[index] = distribution(generator);
+		const auto [B1, B2] = invariant_decomposition(B4);
+		const auto B1B2 = geometric_product(B1, B2), B2B1 = geometric_product(B2, B1);
+		std::cout << "4-D B1 B2 - B2 B1 : grade 2 error " << get_error(std::get<1>(B1B2), std::get<1>(B2B1)) << ", B1 ^ B1 = " << (B1 ^ B1) << ", B2 ^ B2 = " << (B2 ^ B2) << std::endl;
+		const auto R4 = rotor_exp(B4);
+		const auto R4_product = geometric_product(rotor_exp(B1), rotor_exp(B2));
+		std::cout << "4-D exp(B) - exp(B1) exp(B2) : error " << std::max({ get_error(std::get<0>(R4), std::get<0>(R4_product)), get_error(std::get<1>(R4), std::get<1>(R4_product)), get_error(std::get<2>(R4), std::get<2>(R4_product)) })
+			<< ", log(exp(B)) error " << get_error(rotor_log(R4), B4) << std::endl;
+		multivector_t<double, space_mask_4, 2> isoclinic;
+		isoclinic.get<(1 << 0) | (1 << 1)>() = 0.5;
+		isoclinic.get<(1 << 2) | (1 << 3)>() = 0.5;
+		const auto isoclinic_parts = invariant_decomposition(isoclinic);
+		std::cout << "4-D isoclinic : B1 = " << isoclinic_parts.first << ", B2 = " << isoclinic_parts.second << ", log(exp(B)) error " << get_error(rotor_log(rotor_exp(isoclinic)), isoclinic) << std::endl;
+
+		//
+		// batch : 3-D float rotors from SoA bivectors, polynomial approximations against the standard library
+		//
+		enum : size_t { batch_size = (1 << 20), };
+		std::vector<float> streams[3 + 4 + 3];
+		for (auto& stream : streams)
+			stream.resize(batch_size);
+		for (size_t index = 0; index < batch_size; ++index)
+			for (size_t component = 0; component < 3; ++component)
+				streams[component][index] = float(distribution(generator));
+		const multivector_soa_t<float, space_mask_3, 2> bivectors{ { streams[0].data(), streams[1].data(), streams[2].data() }, batch_size };
+		const versor_soa_t<float, space_mask_3, 0, 2> rotors{
+			multivector_soa_t<float, space_mask_3, 0>{ { streams[3].data() }, batch_size },
+			multivector_soa_t<float, space_mask_3, 2>{ { streams[4].data(), streams[5].data(), streams[6].data() }, batch_size },
+		};
+
+		const auto start_batch = std::chrono::high_resolution_clock::now();
+		rotor_exp(rotors, bivectors);
+		const auto end_batch = std::chrono::high_resolution_clock::now();
+
+		float max_error = 0.0f;
+		const auto start_reference = std::chrono::high_resolution_clock::now();
+		for (size_t index = 0; index < batch_size; ++index)
+		{
+			const auto B = bivectors.load(index);
+			const float angle = std::sqrt(B.components[0] * B.components[0] + B.components[1] * B.components[1] + B.components[2] * B.components[2]);
+			const float sinc = (angle > 0.0f) ? std::sin(angle) / angle : 1.0f;
+			max_error = std::max(max_error, std::abs(std::cos(angle) - streams[3][index]));
+			for (size_t component = 0; component < 3; ++component)
+				max_error = std::max(max_error, std::abs(sinc * B.components[component] - streams[4 + component][index]));
+		}
+		const auto end_reference = std::chrono::high_resolution_clock::now();
+		std::cout << batch_size << " rotor_exp : " << std::chrono::duration<double, std::milli>(end_batch - start_batch).count() << "ms (polynomial) vs "
+			<< std::chrono::duration<double, std::milli>(end_reference - start_reference).count() << "ms (std::sin / std::cos), max error " << max_error << std::endl;
+
+		const multivector_soa_t<float, space_mask_3, 2> logs{ { streams[7].data(), streams[8].data(), streams[9].data() }, batch_size };
+		rotor_log(logs, rotors);
+		float max_log_error = 0.0f;
+		for (size_t index = 0; index < batch_size; ++index)
+			max_log_error = std::max(max_log_error, get_error(logs.load(index), bivectors.load(index)));
+		std::cout << batch_size << " rotor_log(rotor_exp(B)) : max error " << max_log_error << std::endl;
+	}
+
+	static test_rotor_exponential instance;
+};
+#if USE_CURRENT_TEST
+test_rotor_exponential test_rotor_exponential::instance;
+#endif // #if USE_CURRENT_TEST
+} // namespace SBLib::Test
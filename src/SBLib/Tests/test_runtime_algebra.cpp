@@ -0,0 +1,138 @@
+#include <test_common.h>
+#include <Mathematics/exterior_algebra.h>
+#include <Mathematics/geometric_product.h>
+#include <Mathematics/runtime_algebra.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#ifdef USE_CURRENT_TEST
+#undef USE_CURRENT_TEST
+#endif
+#define USE_CURRENT_TEST 1
+
+namespace SBLib::Test
+{
+class test_runtime_algebra : public RegisteredFunctor
+{
+	enum : size_t { space_mask = (1 << 4) - 1, };
+	using vector_type   = vector_t<float, space_mask>;
+	using bivector_type = multivector_t<float, space_mask, 2>;
+
+	template<size_t rank_size>
+	static float get_error(const runtime_multivector_t<float>& u, const multivector_t<float, space_mask, rank_size>& v)
+	{
+		const auto part = u.get_part<space_mask, rank_size>();
+		float error = 0.0f;
+		for (size_t index = 0; index < part.dimension_size; ++index)
+			error = std::max(error, std::abs(part.components[index] - v.components[index]));
+		return error;
+	}
+
+	test_runtime_algebra() : RegisteredFunctor(__FUNCTION__, fct) {}
+	static void fct()
+	{
+		std::mt19937 generator(0);
+		std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+		//
+		// runtime (3, 0, 1) algebra against the compile-time projective_metric kernels
+		//
+		const runtime_algebra_tables& pga = runtime_algebra_tables::get(4, projective_metric::negative_mask, projective_metric::null_mask);
+		vector_type u;
+		bivector_type v;
+		for (size_t index = 0; index < u.dimension_size; ++index)
+			u.components[index] = distribution(generator);
+		for (size_t index = 0; index < v.dimension_size; ++index)
+			v.components[index] = distribution(generator);
+		runtime_multivector_t<float> runtime_u(pga), runtime_v(pga);
+		runtime_u.set_part(u);
+		runtime_v.set_part(v);
+
+		const auto product = geometric_product<projective_metric>(u, v);
+		const auto runtime_product = runtime_u * runtime_v;
+		std::cout << "u v : grade 1 error " << get_error(runtime_product, std::get<0>(product)) << ", grade 3 error " << get_error(runtime_product, std::get<1>(product)) << std::endl;
+		std::cout << "u ^ v : error " << get_error(runtime_u ^ runtime_v, u ^ v) << std::endl;
+		std::cout << "*v : error " << get_error(hodge_conjugate(runtime_v), hodge_conjugate<projective_metric>(v)) << std::endl;
+		std::cout << "same tables on second lookup : " << (&runtime_algebra_tables::get(4, projective_metric::negative_mask, projective_metric::null_mask) == &pga) << std::endl;
+
+		//
+		// runtime blade ranking against the compile-time tables, then batch round trips in 40-D
+		//
+		enum : size_t { sparse_mask = (1 << 1) | (1 << 3) | (1 << 4) | (1 << 8) | (1 << 9) | (1 << 12), };
+		using sparse_table = combination_table<sparse_mask, 3>;
+		size_t ranking_error_count = 0;
+		for (size_t index = 0; index < sparse_table::count; ++index)
+			ranking_error_count += (unrank_blade(sparse_mask, 3, index) != sparse_table::blades[index] || rank_blade(sparse_mask, sparse_table::blades[index]) != index) ? 1 : 0;
+		std::cout << "rank_blade / unrank_blade against combination_table : " << ranking_error_count << " errors" << std::endl;
+
+		const size_t wide_mask = (size_t(1) << 40) - 1, wide_rank = 5;
+		std::uniform_int_distribution<size_t> index_distribution(0, size_t(binomial_coefficient_table::get(40, wide_rank)) - 1);
+		std::vector<size_t> indices(1 << 16), blades(indices.size()), ranks(indices.size());
+		for (auto& index : indices)
+			index = index_distribution(generator);
+		const auto start_ranking = std::chrono::high_resolution_clock::now();
+		unrank_blades(blades.data(), wide_mask, wide_rank, indices.data(), indices.size());
+		rank_blades(ranks.data(), wide_mask, blades.data(), blades.size());
+		const auto end_ranking = std::chrono::high_resolution_clock::now();
+		std::cout << indices.size() << " 40-D rank 5 round trips : " << std::chrono::duration<double, std::milli>(end_ranking - start_ranking).count() << "ms, "
+			<< (indices == ranks ? "identical" : "different") << " indices" << std::endl;
+
+		//
+		// batch blade signs against the scalar ones, over every pair of 8-D blades
+		//
+		std::vector<size_t> firsts, seconds;
+		for (size_t first = 0; first < 256; ++first)
+			for (size_t second = 0; second < 256; ++second)
+			{
+				firsts.push_back(first);
+				seconds.push_back(second);
+			}
+		std::vector<float> geometric_signs(firsts.size()), exterior_signs(firsts.size());
+		const auto start_signs = std::chrono::high_resolution_clock::now();
+		get_blade_signs(geometric_signs.data(), firsts.data(), seconds.data(), firsts.size(), projective_metric::null_mask, projective_metric::negative_mask);
+		get_blade_signs(exterior_signs.data(), firsts.data(), seconds.data(), firsts.size(), ~size_t(0));
+		const auto end_signs = std::chrono::high_resolution_clock::now();
+		size_t sign_error_count = 0;
+		for (size_t index = 0; index < firsts.size(); ++index)
+			sign_error_count += (geometric_signs[index] != float(get_geometric_sign<projective_metric>(firsts[index], seconds[index]))
+				|| exterior_signs[index] != float(get_alternating_sign(firsts[index], seconds[index]))) ? 1 : 0;
+		std::cout << firsts.size() << " batch blade signs : " << std::chrono::duration<double, std::milli>(end_signs - start_signs).count() << "ms, "
+			<< sign_error_count << " errors" << std::endl;
+
+		//
+		// throughput of full products : tabled up to max_table_dimension, untabled above
+		//
+		for (size_t dimension_size : { 4, 6, 8, 10, 11 })
+		{
+			const auto start_tables = std::chrono::high_resolution_clock::now();
+			const runtime_algebra_tables& algebra = runtime_algebra_tables::get(dimension_size);
+			const auto end_tables = std::chrono::high_resolution_clock::now();
+
+			runtime_multivector_t<float> a(algebra), b(algebra);
+			for (size_t index = 0; index < algebra.component_count; ++index)
+			{
+				a.components[index] = distribution(generator);
+				b.components[index] = distribution(generator);
+			}
+			const size_t repeat_count = std::max<size_t>(1, (size_t(1) << 22) / (algebra.component_count * algebra.component_count));
+			float checksum = 0.0f;
+			const auto start_products = std::chrono::high_resolution_clock::now();
+			for (size_t repeat = 0; repeat < repeat_count; ++repeat)
+				checksum += (a * b).components[0];
+			const auto end_products = std::chrono::high_resolution_clock::now();
+			std::cout << "dimension " << dimension_size << (algebra.has_product_tables() ? " (tabled)" : " (untabled)") << " : tables "
+				<< std::chrono::duration<double, std::milli>(end_tables - start_tables).count() << "ms, product "
+				<< std::chrono::duration<double, std::micro>(end_products - start_products).count() / repeat_count << "us (" << checksum << ")" << std::endl;
+		}
+	}
+
+	static test_runtime_algebra instance;
+};
+#if USE_CURRENT_TEST
+test_runtime_algebra test_runtime_algebra::instance;
+#endif // #if USE_CURRENT_TEST
+} // namespace SBLib::Test
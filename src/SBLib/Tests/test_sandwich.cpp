@@ -0,0 +1,102 @@
+#include <test_common.h>
+#include <Mathematics/exterior_algebra.h>
+#include <Mathematics/sandwich.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#ifdef USE_CURRENT_TEST
+#undef USE_CURRENT_TEST
+#endif
+#define USE_CURRENT_TEST 1
+
+namespace SBLib::Test
+{
+class test_sandwich : public RegisteredFunctor
+{
+	enum
+	{
+		e0 = (1 << 0), e1 = (1 << 1),
+		e2 = (1 << 2), e3 = (1 << 3),
+	};
+	using vector_type   = vector_t<float, e0 | e1 | e2>;
+	using bivector_type = multivector_t<float, e0 | e1 | e2, 2>;
+	using rotor_type    = versor_t<float, e0 | e1 | e2, 0, 2>;
+
+	test_sandwich() : RegisteredFunctor(__FUNCTION__, fct) {}
+	static void fct()
+	{
+		// R = cos(angle / 2) - sin(angle / 2) (e0 ^ e1) rotates e0 towards e1 by angle
+		const float angle = 0.5f;
+		bivector_type plane;
+		plane.get<e0 | e1>() = -std::sin(0.5f * angle);
+		const rotor_type R{ multivector_t<float, e0 | e1 | e2, 0>{ std::cos(0.5f * angle) }, plane };
+		const vector_type u{ 1.0f, 0.0f, 2.0f };
+		std::cout << "R u R~ = " << sandwich(R, u) << " ~ " << vector_type{ std::cos(angle), std::sin(angle), 2.0f } << std::endl;
+		std::cout << "R (u ^ e1) R~ = " << sandwich(R, u ^ vector_type{ 0.0f, 1.0f, 0.0f })
+			<< " ~ " << (sandwich(R, u) ^ sandwich(R, vector_type{ 0.0f, 1.0f, 0.0f })) << std::endl;
+
+		// reflection through the plane orthogonal to e2 : -n u n~
+		const versor_t<float, e0 | e1 | e2, 1> n{ vector_type{ 0.0f, 0.0f, 1.0f } };
+		std::cout << "n u n~ = " << sandwich(n, u) << std::endl;
+
+		// the gathered kernel against the matrix hoisted by the batch versions
+		std::cout << "sandwich_map(R) u = " << sandwich_map<1>(R)(u) << " ~ " << sandwich(R, u) << std::endl;
+
+		//
+		// batch : one rotor applied to many vectors, then many rotors applied to many vectors
+		//
+		std::mt19937 generator(0);
+		std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+		enum : size_t { batch_size = (1 << 20), };
+		std::vector<float> streams[7];
+		for (auto& stream : streams)
+		{
+			stream.resize(batch_size);
+			for (auto& value : stream)
+				value = distribution(generator);
+		}
+		std::vector<float> results[3];
+		for (auto& stream : results)
+			stream.resize(batch_size);
+		const vector_soa_t<float, e0 | e1 | e2> points{ { streams[0].data(), streams[1].data(), streams[2].data() }, batch_size };
+		const vector_soa_t<float, e0 | e1 | e2> rotated{ { results[0].data(), results[1].data(), results[2].data() }, batch_size };
+
+		const auto start_single = std::chrono::high_resolution_clock::now();
+		sandwich(rotated, R, points);
+		const auto end_single = std::chrono::high_resolution_clock::now();
+		std::cout << batch_size << " vectors rotated by one rotor : "
+			<< std::chrono::duration<double, std::milli>(end_single - start_single).count() << "ms" << std::endl;
+
+		const versor_soa_t<float, e0 | e1 | e2, 0, 2> rotors{
+			multivector_soa_t<float, e0 | e1 | e2, 0>{ { streams[3].data() }, batch_size },
+			multivector_soa_t<float, e0 | e1 | e2, 2>{ { streams[4].data(), streams[5].data(), streams[6].data() }, batch_size },
+		};
+		const auto start_many = std::chrono::high_resolution_clock::now();
+		sandwich(rotated, rotors, points);
+		const auto end_many = std::chrono::high_resolution_clock::now();
+
+		// rotors are not normalized : rotated lengths are |u| |R|^2
+		float max_error = 0.0f;
+		for (size_t index = 0; index < batch_size; ++index)
+		{
+			const vector_type p = points.load(index), q = rotated.load(index);
+			const float s = streams[3][index], b0 = streams[4][index], b1 = streams[5][index], b2 = streams[6][index];
+			const float norm2 = s * s + b0 * b0 + b1 * b1 + b2 * b2;
+			const float p2 = (p.components[0] * p.components[0] + p.components[1] * p.components[1] + p.components[2] * p.components[2]);
+			const float q2 = (q.components[0] * q.components[0] + q.components[1] * q.components[1] + q.components[2] * q.components[2]);
+			max_error = std::max(max_error, std::abs(std::sqrt(q2) - std::sqrt(p2) * norm2));
+		}
+		std::cout << batch_size << " vectors rotated by as many rotors : "
+			<< std::chrono::duration<double, std::milli>(end_many - start_many).count() << "ms, max length error " << max_error << std::endl;
+	}
+
+	static test_sandwich instance;
+};
+#if USE_CURRENT_TEST
+test_sandwich test_sandwich::instance;
+#endif // #if USE_CURRENT_TEST
+} // namespace SBLib::Test
@@ -0,0 +1,130 @@
+#include <test_common.h>
+#include <Mathematics/exterior_algebra.h>
+#include <Mathematics/geometric_product.h>
+#include <Mathematics/sparse_multivector.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#ifdef USE_CURRENT_TEST
+#undef USE_CURRENT_TEST
+#endif
+#define USE_CURRENT_TEST 1
+
+namespace SBLib::Test
+{
+class test_sparse_multivector : public RegisteredFunctor
+{
+	enum : size_t
+	{
+		space_mask_6  = (1 << 6) - 1,
+		space_mask_10 = (1 << 10) - 1,
+		space_mask_64 = ~size_t(0),
+	};
+
+	template<typename sparse_type, typename dense_type>
+	static float get_error(const sparse_type& sparse, const dense_type& dense)
+	{
+		return get_error(sparse, make_sparse(dense));
+	}
+	template<typename sparse_type>
+	static float get_error(const sparse_type& sparse, const sparse_type& reference)
+	{
+		float error = 0.0f;
+		for (const auto& term : (sparse - reference).terms)
+			error = std::max(error, std::abs(term.value));
+		return error;
+	}
+	template<typename type_t>
+	static double get_time(type_t&& fct, size_t repeat_count)
+	{
+		const auto start = std::chrono::high_resolution_clock::now();
+		for (size_t repeat = 0; repeat < repeat_count; ++repeat)
+			fct();
+		const auto end = std::chrono::high_resolution_clock::now();
+		return std::chrono::duration<double, std::micro>(end - start).count() / repeat_count;
+	}
+
+	test_sparse_multivector() : RegisteredFunctor(__FUNCTION__, fct) {}
+	static void fct()
+	{
+		std::mt19937 generator(0);
+		std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+		//
+		// sparse products against the dense ones in 6-D
+		//
+		vector_t<float, space_mask_6> u;
+		multivector_t<float, space_mask_6, 2> v;
+		for (size_t index = 0; index < u.dimension_size; ++index)
+			u.components[index] = distribution(generator);
+		for (size_t index = 0; index < v.dimension_size; ++index)
+			v.components[index] = distribution(generator);
+		const auto sparse_u = make_sparse(u), sparse_v = make_sparse(v);
+		const auto dense_product = geometric_product(u, v);
+		std::cout << "6-D u ^ v : sparse x sparse error " << get_error(sparse_u ^ sparse_v, u ^ v)
+			<< ", sparse x dense error " << get_error(sparse_u ^ v, u ^ v)
+			<< ", dense x sparse error " << get_error(u ^ sparse_v, u ^ v) << std::endl;
+		std::cout << "6-D u v : sparse x sparse error " << get_error(sparse_u * sparse_v, make_sparse(std::get<0>(dense_product)) + make_sparse(std::get<1>(dense_product)))
+			<< ", sparse x dense error " << get_error(geometric_product(sparse_u, v), make_sparse(std::get<0>(dense_product)) + make_sparse(std::get<1>(dense_product)))
+			<< " (" << (sparse_u * sparse_v).size() << " terms)" << std::endl;
+
+		//
+		// 64-D : products of a few hundred rank 32 blades, which dense storage could not hold
+		//
+		std::vector<size_t> bits(64);
+		std::iota(bits.begin(), bits.end(), size_t(0));
+		auto get_random_blade = [&]()
+		{
+			std::shuffle(bits.begin(), bits.end(), generator);
+			size_t blade_mask = 0;
+			for (size_t index = 0; index < 32; ++index)
+				blade_mask |= (size_t(1) << bits[index]);
+			return blade_mask;
+		};
+		sparse_multivector_t<float, space_mask_64> A, B;
+		for (size_t index = 0; index < 256; ++index)
+		{
+			A[get_random_blade()] = distribution(generator);
+			B[get_random_blade()] = distribution(generator);
+		}
+		sparse_multivector_t<float, space_mask_64> AB;
+		const double product_time = get_time([&]() { AB = A * B; }, 16);
+		std::cout << "64-D rank 32 : " << A.size() << " x " << B.size() << " terms -> " << AB.size() << " terms in " << product_time << "us" << std::endl;
+
+		//
+		// crossover : 10-D vector ^ rank 3 multivector (120 components) with a growing number of non-zero components
+		//
+		enum : size_t { repeat_count = 1024, };
+		vector_t<float, space_mask_10> x;
+		for (size_t index = 0; index < x.dimension_size; ++index)
+			x.components[index] = distribution(generator);
+		const auto sparse_x = make_sparse(x);
+		for (size_t non_zero_count : { 1, 4, 16, 32, 64, 120 })
+		{
+			multivector_t<float, space_mask_10, 3> y;
+			for (size_t index = 0; index < non_zero_count; ++index)
+				y.components[(index * 37) % y.dimension_size] = distribution(generator);
+			const auto sparse_y = make_sparse(y);
+
+			multivector_t<float, space_mask_10, 4> dense_result;
+			sparse_multivector_t<float, space_mask_10> sparse_result, mixed_result;
+			const double dense_time  = get_time([&]() { dense_result = x ^ y; }, repeat_count);
+			const double sparse_time = get_time([&]() { sparse_result = sparse_x ^ sparse_y; }, repeat_count);
+			const double mixed_time  = get_time([&]() { mixed_result = x ^ sparse_y; }, repeat_count);
+			std::cout << sparse_y.size() << " non-zero components : " << dense_time << "us (dense) vs "
+				<< sparse_time << "us (sparse x sparse) vs " << mixed_time << "us (dense x sparse), error "
+				<< std::max(get_error(sparse_result, dense_result), get_error(mixed_result, dense_result)) << std::endl;
+		}
+	}
+
+	static test_sparse_multivector instance;
+};
+#if USE_CURRENT_TEST
+test_sparse_multivector test_sparse_multivector::instance;
+#endif // #if USE_CURRENT_TEST
+} // namespace SBLib::Test
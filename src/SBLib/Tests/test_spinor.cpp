@@ -0,0 +1,100 @@
+#include <test_common.h>
+#include <Mathematics/spinor.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#ifdef USE_CURRENT_TEST
+#undef USE_CURRENT_TEST
+#endif
+#define USE_CURRENT_TEST 1
+
+namespace SBLib::Test
+{
+class test_spinor : public RegisteredFunctor
+{
+	enum
+	{
+		e0 = (1 << 0), e1 = (1 << 1),
+		e2 = (1 << 2), e3 = (1 << 3),
+	};
+	using spinor_type   = spinor_t<float, e0 | e1 | e2>;
+	using versor_type   = spinor_type::versor_type;
+	using bivector_type = multivector_t<float, e0 | e1 | e2, 2>;
+	using vector_type   = vector_t<float, e0 | e1 | e2>;
+
+	test_spinor() : RegisteredFunctor(__FUNCTION__, fct) {}
+	static void fct()
+	{
+		std::cout << "sizeof(spinor_t<float, 3-D>) = " << sizeof(spinor_type) << ", alignment " << alignof(spinor_type) << std::endl;
+
+		// rotation of 90 degrees in the e0 ^ e1 plane, i.e., the quaternion cos(pi/4) - sin(pi/4) k
+		bivector_type plane;
+		plane.get<e0 | e1>() = -std::sin(0.7853982f);
+		const spinor_type R(versor_type{ multivector_t<float, e0 | e1 | e2, 0>{ std::cos(0.7853982f) }, plane });
+		std::cout << "R = (" << R.components[0] << ", " << R.components[1] << ", " << R.components[2] << ", " << R.components[3] << ")" << std::endl;
+		std::cout << "R (1, 0, 0) R~ = " << sandwich(R, vector_type{ 1.0f, 0.0f, 0.0f }) << " ~ (0, 1, 0)" << std::endl;
+		std::cout << "R R~ = " << (R * conjugate(R)).components[0] << ", grade 2 part " << (R * conjugate(R)).get_part<2>() << std::endl;
+		const spinor_type RR = R * R;
+		std::cout << "R R (1, 0, 0) R~ R~ = " << sandwich(RR, vector_type{ 1.0f, 0.0f, 0.0f }) << " ~ (-1, 0, 0)" << std::endl;
+
+		//
+		// batch : packed Hamilton product against the separate-grade geometric product
+		//
+		std::mt19937 generator(0);
+		std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+		enum : size_t { batch_size = (1 << 20), };
+		std::vector<spinor_type> spinors(batch_size);
+		std::vector<versor_type> versors(batch_size);
+		for (size_t index = 0; index < batch_size; ++index)
+		{
+			spinor_type spinor;
+			for (size_t component = 0; component < spinor_type::dimension_size; ++component)
+				spinor.components[component] = distribution(generator);
+			spinors[index] = normalize(spinor);
+			versors[index] = spinors[index].to_versor();
+		}
+
+		spinor_type accumulated_spinor(versor_type{ multivector_t<float, e0 | e1 | e2, 0>{ 1.0f }, bivector_type{} });
+		const auto start_spinor = std::chrono::high_resolution_clock::now();
+		for (const auto& spinor : spinors)
+			accumulated_spinor = spinor * accumulated_spinor;
+		const auto end_spinor = std::chrono::high_resolution_clock::now();
+
+		versor_type accumulated_versor{ multivector_t<float, e0 | e1 | e2, 0>{ 1.0f }, bivector_type{} };
+		const auto start_versor = std::chrono::high_resolution_clock::now();
+		for (const auto& versor : versors)
+			accumulated_versor = geometric_product(versor, accumulated_versor);
+		const auto end_versor = std::chrono::high_resolution_clock::now();
+
+		float max_error = 0.0f;
+		for (size_t index = 0; index + 1 < batch_size; index += 4099)
+		{
+			const spinor_type packed = spinors[index] * spinors[index + 1];
+			const spinor_type reference(geometric_product(versors[index], versors[index + 1]));
+			for (size_t component = 0; component < spinor_type::dimension_size; ++component)
+				max_error = std::max(max_error, std::abs(packed.components[component] - reference.components[component]));
+		}
+		std::cout << batch_size << " products : "
+			<< std::chrono::duration<double, std::milli>(end_spinor - start_spinor).count() << "ms (packed spinor) vs "
+			<< std::chrono::duration<double, std::milli>(end_versor - start_versor).count() << "ms (separate grades), max error " << max_error
+			<< ", |S|^2 = " << norm_squared(accumulated_spinor) << " ~ " << norm_squared(spinor_type(accumulated_versor)) << std::endl;
+
+		// 4-D spinors (scalar, 6 bivectors, pseudo-scalar) use the generic path
+		using spinor4_type = spinor_t<float, e0 | e1 | e2 | e3>;
+		spinor4_type S4;
+		for (size_t component = 0; component < spinor4_type::dimension_size; ++component)
+			S4.components[component] = distribution(generator);
+		const spinor4_type N4 = normalize(S4);
+		std::cout << "4-D : |N|^2 = " << norm_squared(N4) << ", N N~ = " << (N4 * conjugate(N4)).components[0] << std::endl;
+	}
+
+	static test_spinor instance;
+};
+#if USE_CURRENT_TEST
+test_spinor test_spinor::instance;
+#endif // #if USE_CURRENT_TEST
+} // namespace SBLib::Test
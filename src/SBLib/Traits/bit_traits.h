@@ -1,75 +1,104 @@
 #pragma once
 #include <Algorithms/static_for_each.h>
+
+#if !defined(USE_BMI2_BIT_KERNELS)
+#if defined(__AVX2__) && (defined(_M_X64) || defined(__x86_64__))
+#define USE_BMI2_BIT_KERNELS 1
+#else
+#define USE_BMI2_BIT_KERNELS 0
+#endif
+#endif // #if !defined(USE_BMI2_BIT_KERNELS)
+
+#if USE_BMI2_BIT_KERNELS
+#include <immintrin.h>
+#endif // #if USE_BMI2_BIT_KERNELS
+
 namespace SBLib::Traits
 {
+//
+// get_deposited_bits / get_extracted_bits
+// Scatter the low bits of bits to the set bits of bit_mask, and gather them back (constexpr parallel bit deposit and extract).
+//
+inline constexpr unsigned long long get_deposited_bits(unsigned long long bits, unsigned long long bit_mask)
+{
+	unsigned long long result = 0;
+	for (unsigned long long bit = 1; bit_mask != 0; bit <<= 1, bit_mask &= bit_mask - 1)
+		if ((bits & bit) != 0)
+			result |= bit_mask & ~(bit_mask - 1);
+	return result;
+}
+inline constexpr unsigned long long get_extracted_bits(unsigned long long bits, unsigned long long bit_mask)
+{
+	unsigned long long result = 0;
+	for (unsigned long long bit = 1; bit_mask != 0; bit <<= 1, bit_mask &= bit_mask - 1)
+		if ((bits & bit_mask & ~(bit_mask - 1)) != 0)
+			result |= bit;
+	return result;
+}
+
+//
+// get_population_count
+// Runtime counterpart of bit_traits<bit_mask>::population_count, for bit masks only known at run time. Branchless and constexpr
+// (SWAR sums of bit pairs, nibbles, then bytes), so that bit_traits is built on it ; count_bits uses popcnt at run time.
+//
+inline constexpr size_t get_population_count(unsigned long long bit_mask)
+{
+	bit_mask = bit_mask - ((bit_mask >> 1) & 0x5555555555555555ull);
+	bit_mask = (bit_mask & 0x3333333333333333ull) + ((bit_mask >> 2) & 0x3333333333333333ull);
+	bit_mask = (bit_mask + (bit_mask >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+	return size_t((bit_mask * 0x0101010101010101ull) >> 56);
+}
+
+//
+// get_trailing_zero_count / get_bit_width
+// Position of the lowest set bit (64 for 0) and number of bits up to the highest set bit (0 for 0), for bit masks only known
+// at run time : the lowest bit minus one, or the highest bit smeared down, is a mask whose population count is the answer.
+//
+inline constexpr size_t get_trailing_zero_count(unsigned long long bit_mask)
+{
+	return get_population_count((bit_mask & ~(bit_mask - 1)) - 1);
+}
+inline constexpr size_t get_bit_width(unsigned long long bit_mask)
+{
+	bit_mask |= bit_mask >> 1;
+	bit_mask |= bit_mask >> 2;
+	bit_mask |= bit_mask >> 4;
+	bit_mask |= bit_mask >> 8;
+	bit_mask |= bit_mask >> 16;
+	bit_mask |= bit_mask >> 32;
+	return get_population_count(bit_mask);
+}
+
+//
+// bit_traits
+// Set bits of bit_mask, from the lowest : get_bit<index>() is the index-th set bit, get_bit_component<bit>() the number of set
+// bits below bit and get_bit_index<bit>() the position of bit.
+//
 template<size_t bit_mask>
 struct bit_traits
 {
-private:
-	enum : size_t
-	{
-		first_bit        = (((bit_mask - 1) & ~bit_mask) + 1),
-		remaining_bits   = (bit_mask & ~first_bit),
-	};
-public:
 	enum : size_t
 	{
 		bit_mask         = bit_mask,
-		population_count = 1 + bit_traits<remaining_bits>::population_count,
+		population_count = get_population_count(bit_mask),
 	};
 
 	template<size_t index>
 	static constexpr size_t get_bit()
 	{
-		return bit_traits<remaining_bits>::get_bit<index - 1>();
-	}
-	template<>
-	static constexpr size_t get_bit<0>()
-	{
-		return first_bit;
+		return (index < population_count) ? size_t(get_deposited_bits(1ull << index, bit_mask)) : 0;
 	}
 
 	template<size_t bit_value>
 	static constexpr size_t get_bit_component()
 	{
-		return bit_traits<remaining_bits>::get_bit_component<bit_value>() + 1;
-	}
-	template<>
-	static constexpr size_t get_bit_component<first_bit>()
-	{
-		return 0;
-	}
-
-	template<size_t bit_value>
-	static constexpr size_t get_bit_index()
-	{
-		return bit_traits<bit_value - 1>::population_count;
+		return get_population_count(bit_mask & (bit_value - 1));
 	}
-};
-template<>
-struct bit_traits<0>
-{
-public:
-	enum : size_t
-	{
-		value = 0,
-		population_count = 0,
-	};
 
-	template<size_t index>
-	static constexpr size_t get_bit()
-	{
-		return 0;
-	}
 	template<size_t bit_value>
-	static constexpr size_t get_bit_component()
-	{
-		return 0;
-	}
-	template<size_t index>
 	static constexpr size_t get_bit_index()
 	{
-		return 0;
+		return get_trailing_zero_count(bit_value);
 	}
 };
 
@@ -111,10 +140,75 @@ struct next_bit_helper
 		enum : size_t { next_index = bit_traits<bit_mask>::get_bit_component<bit>() + 1, };
 		return bit_traits<bit_mask>::get_bit<next_index>();
 	}
+	static constexpr size_t get_next(size_t bit)
+	{
+		const size_t higher_bits = bit_mask & ~((bit << 1) - 1);
+		return higher_bits & ~(higher_bits - 1);
+	}
 };
 
 template<size_t bit_mask> struct for_each_bit : static_for_each<0, bit_traits<bit_mask>::population_count, get_bit_helper<bit_mask>> {};
 template<size_t bit_mask> struct for_each_bit_compoment : static_for_each<bit_traits<bit_mask>::get_bit<0>(), bit_traits<bit_mask>::get_bit<bit_traits<bit_mask>::population_count>(), get_bit_component_helper<bit_mask>, next_bit_helper<bit_mask>> {};
 template<size_t bit_mask> struct for_each_bit_index : static_for_each<bit_traits<bit_mask>::get_bit<0>(), bit_traits<bit_mask>::get_bit<bit_traits<bit_mask>::population_count>(), get_bit_index_helper<bit_mask>, next_bit_helper<bit_mask>> {};
+
+//
+// get_prefix_parity_mask
+// Bit k of the result is set when bits has an odd number of set bits strictly below k (exclusive prefix xor, in 6 shifts).
+//
+inline constexpr unsigned long long get_prefix_parity_mask(unsigned long long bits)
+{
+	bits <<= 1;
+	bits ^= bits << 1;
+	bits ^= bits << 2;
+	bits ^= bits << 4;
+	bits ^= bits << 8;
+	bits ^= bits << 16;
+	bits ^= bits << 32;
+	return bits;
+}
+
+//
+// count_bits / count_trailing_zeros
+// Runtime get_population_count / get_trailing_zero_count : a single popcnt / tzcnt when USE_BMI2_BIT_KERNELS is set (every
+// processor with AVX2 and BMI2 has both), the constexpr versions otherwise.
+//
+inline size_t count_bits(size_t bit_mask)
+{
+#if USE_BMI2_BIT_KERNELS
+	return size_t(_mm_popcnt_u64(bit_mask));
+#else // #if USE_BMI2_BIT_KERNELS
+	return get_population_count(bit_mask);
+#endif // #if USE_BMI2_BIT_KERNELS
+}
+inline size_t count_trailing_zeros(size_t bit_mask)
+{
+#if USE_BMI2_BIT_KERNELS
+	return size_t(_tzcnt_u64(bit_mask));
+#else // #if USE_BMI2_BIT_KERNELS
+	return get_trailing_zero_count(bit_mask);
+#endif // #if USE_BMI2_BIT_KERNELS
+}
+
+//
+// deposit_bits / extract_bits
+// Runtime get_deposited_bits / get_extracted_bits : a single pdep / pext with BMI2 (assumed along with AVX2, 64-bit only),
+// the constexpr loops otherwise. Both are microcoded on AMD processors before Zen 3, where the loops may be faster.
+//
+inline size_t deposit_bits(size_t bits, size_t bit_mask)
+{
+#if USE_BMI2_BIT_KERNELS
+	return size_t(_pdep_u64(bits, bit_mask));
+#else // #if USE_BMI2_BIT_KERNELS
+	return size_t(get_deposited_bits(bits, bit_mask));
+#endif // #if USE_BMI2_BIT_KERNELS
+}
+inline size_t extract_bits(size_t bits, size_t bit_mask)
+{
+#if USE_BMI2_BIT_KERNELS
+	return size_t(_pext_u64(bits, bit_mask));
+#else // #if USE_BMI2_BIT_KERNELS
+	return size_t(get_extracted_bits(bits, bit_mask));
+#endif // #if USE_BMI2_BIT_KERNELS
+}
 } // namespace SBLib::Traits
 namespace SBLib { using namespace Traits; }
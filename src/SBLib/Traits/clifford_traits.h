@@ -1,12 +1,18 @@
 #pragma once
 #include <Traits/bit_traits.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif // #if defined(__AVX2__)
+
 namespace SBLib::Traits::Mathematics
 {
 	// Clifford Traits
 	//
-	// Herein, multivector blades are represented as ordered bitsets in Euclidian space.
+	// Herein, multivector blades are represented as ordered bitsets over an orthogonal basis.
 	// For instance scalar is 0, vectors are 1-bits numbers, bivectors are 2-bits, etc.
 	// Default ordering is big endian : that is, for instance, (e0^e1) is selected over (e1^e0).
+	// Default metric is Euclidian (every basis vector squares to +1), c.f., metric_signature for other signatures.
 	//
 	// c.f., clifford_traits_tests.cpp for examples.
 	//
@@ -23,6 +29,72 @@ namespace SBLib::Traits::Mathematics
 	static const bool default_basis_big_endian = true;
 
 
+	//
+	// metric_signature
+	// Diagonal metric of the basis : e_i e_i = -1 for the bits of negative_mask, 0 for the bits of null_mask and +1 otherwise.
+	// signature_t<p, q, r> assigns the p first basis vectors to +1, the q next ones to -1 and the r next ones to 0, so that
+	//	spacetime_metric  = signature_t<1, 3>    : e0 timelike, e1, e2, e3 spacelike,
+	//	projective_metric = signature_t<3, 0, 1> : e3 is the null (ideal) direction of plane-based PGA,
+	//	conformal_metric  = signature_t<4, 1>    : e4 squares to -1, so that e4 - e3 and e4 + e3 are null.
+	// Other assignments of the same signature are obtained directly from the masks, e.g. metric_signature<0, (1 << 0)> for a null e0.
+	//
+	template<size_t negative_mask, size_t null_mask = 0>
+	struct metric_signature
+	{
+		static_assert((negative_mask & null_mask) == 0, "Basis vectors cannot be both negative and null.");
+		enum : size_t
+		{
+			negative_mask = negative_mask,
+			null_mask     = null_mask,
+		};
+	};
+	template<size_t positive_count, size_t negative_count, size_t null_count = 0>
+	using signature_t = metric_signature<(((size_t(1) << negative_count) - 1) << positive_count), (((size_t(1) << null_count) - 1) << (positive_count + negative_count))>;
+
+	using euclidian_metric  = metric_signature<0, 0>;
+	using spacetime_metric  = signature_t<1, 3>;
+	using projective_metric = signature_t<3, 0, 1>;
+	using conformal_metric  = signature_t<4, 1>;
+
+
+	//
+	// metric_traits
+	// Calculates the square of a blade made of mutually orthogonal basis vectors, up to its reordering sign :
+	// the product of the squares of its vectors, that is 0 if any of them is null and -1 for an odd number of negative ones.
+	//
+	template<size_t in_bit_set, typename metric_type = euclidian_metric>
+	struct metric_traits
+	{
+	private:
+		enum : size_t
+		{
+			negative_count = bit_traits<(in_bit_set & metric_type::negative_mask)>::population_count,
+		};
+	public:
+		enum : int
+		{
+			sign = (in_bit_set & metric_type::null_mask) != 0 ? 0 : (negative_count & 1) != 0 ? -1 : +1,
+		};
+	};
+
+
+	//
+	// get_permutation_parity
+	// Parity of the number of (first, second) vector pairs out of basis order, i.e., of the transpositions reordering first ^ second.
+	// In big endian, each vector of first is out of order with the vectors of second below it : the count is the sum, over the
+	// bits of first, of the prefix population counts of second, whose parity is popcount(first & prefix parity mask of second).
+	// In little endian, first and second swap roles. Closed form : no loop nor recursion over the bits.
+	//
+	template<bool big_endian = default_basis_big_endian>
+	inline constexpr size_t get_permutation_parity(size_t first, size_t second)
+	{
+		if (big_endian)
+			return get_population_count(first & get_prefix_parity_mask(second)) & 1;
+		else
+			return get_population_count(second & get_prefix_parity_mask(first)) & 1;
+	}
+
+
 	//
 	// alternating_traits
 	// Calculates the residual sign and bit_set the wedge product of two blades.
@@ -39,78 +111,49 @@ namespace SBLib::Traits::Mathematics
 	//	alternating_traits<(1 << 0)|(1 << 2)|(1 << 4), (1 << 1)|(1 << 3)>::sign    == -1;
 	//	alternating_traits<(1 << 0)|(1 << 2)|(1 << 4), (1 << 1)|(1 << 3)>::bit_set == (1 << 0)|(1 << 1)|(1 << 2)|(1 << 3)|(1 << 4);
 	//
+	// The sign is the closed form get_permutation_parity : a single instantiation, whatever the grades.
+	//
 	template<size_t first, size_t second, bool big_endian = default_basis_big_endian>
 	struct alternating_traits
 	{
-	private:
-		typedef bit_traits<first>  first_traits;
-		typedef bit_traits<second> second_traits;
-		enum : size_t
-		{
-			second_grade             = second_traits::population_count,
-			second_permute_bit_index = (big_endian ? 0 : second_grade - 1),
-			second_permute_bit       = second_traits::get_bit<second_permute_bit_index>(),
-
-			low_bit_mask                  = (second_permute_bit << 1) - 1,
-			high_bit_mask                 = ~low_bit_mask,
-			permute_bit_mask              = (first & (big_endian ? high_bit_mask : low_bit_mask)),
-			permute_bit_permutation_count = bit_traits<permute_bit_mask>::population_count,
-
-			next_first  = (first | second_permute_bit),
-			next_second = (second & ~second_permute_bit),
-		};
-		enum : int
-		{
-			last_bit_sign = (permute_bit_permutation_count & 1) != 0 ? -1 : +1,
-			residual_sign = alternating_traits<next_first, next_second, big_endian>::sign,
-		};
 	public:
 		enum : int
 		{
-			sign = (first & second) != 0 ? 0 : last_bit_sign * residual_sign,
+			sign = (first & second) != 0 ? 0 : get_permutation_parity<big_endian>(first, second) != 0 ? -1 : +1,
 		};
 		enum : size_t
 		{
 			bit_set = (first & second) != 0 ? 0 : (first | second),
 		};
 	};
-	template<size_t first, bool big_endian>
-	struct alternating_traits<first, 0, big_endian>
-	{
-	public:
-		enum : int
-		{
-			sign = +1,
-		};
-		enum : size_t
-		{
-			bit_set = first,
-		};
-	};
-	template<size_t second, bool big_endian>
-	struct alternating_traits<0, second, big_endian>
-	{
-	public:
-		enum : int
-		{
-			sign = +1,
-		};
-		enum : size_t
-		{
-			bit_set = second,
-		};
-	};
-	template<bool big_endian>
-	struct alternating_traits<0, 0, big_endian>
+
+
+	//
+	// geometric_traits
+	// Calculates the residual sign and bit_set of the geometric product of two blades.
+	// Unlike alternating_traits, common vectors do not vanish but contract (e_i e_i = metric sign), so bit_set = first ^ second.
+	// The sign is the parity of the number of (first, second) vector pairs out of basis order, each of which
+	// costs one transposition when moving the vectors of the second blade in place, times the square of the common vectors.
+	// Products contracting a null vector have sign 0 : kernels skip them at compile time.
+	//
+	// The exterior product does not depend on the metric, which is why alternating_traits has no metric parameter.
+	//
+	// For instance, (e0^e1) (e1^e2) = (e0^e2) while (e1^e2) (e0^e1) = -(e0^e2) :
+	//	geometric_traits<(1 << 0)|(1 << 1), (1 << 1)|(1 << 2)>::sign    == +1;
+	//	geometric_traits<(1 << 1)|(1 << 2), (1 << 0)|(1 << 1)>::sign    == -1;
+	//	geometric_traits<(1 << 1)|(1 << 2), (1 << 0)|(1 << 1)>::bit_set == (1 << 0)|(1 << 2);
+	//
+	template<size_t first, size_t second, bool big_endian = default_basis_big_endian, typename metric_type = euclidian_metric>
+	struct geometric_traits
 	{
 	public:
 		enum : int
 		{
-			sign = +1,
+			sign = metric_traits<(first & second), metric_type>::sign * (get_permutation_parity<big_endian>(first, second) != 0 ? -1 : +1),
 		};
 		enum : size_t
 		{
-			bit_set = 0,
+			bit_set = (first ^ second),
 		};
 	};
 
@@ -189,8 +232,10 @@ namespace SBLib::Traits::Mathematics
 	//	*e1 = -(e0^e2),
 	//	*e2 = +(e0^e1).
 	// In general, hodge duals satisfies B ^ *B = *1.
+	// With a non-Euclidian metric, the sign is multiplied by the square of the projected blade so that B ^ *B = (B.B) *1
+	// (sign 0 when the blade contains a null vector, the metric Hodge dual being degenerate).
 	//
-	template<size_t in_bit_set, size_t mask, bool big_endian = default_basis_big_endian>
+	template<size_t in_bit_set, size_t mask, bool big_endian = default_basis_big_endian, typename metric_type = euclidian_metric>
 	struct hodge_conjugacy_traits
 	{
 	private:
@@ -205,11 +250,12 @@ namespace SBLib::Traits::Mathematics
 			hodge_sign         = alternating_traits<parallel_projection, hodge_complement, big_endian>::sign,
 			perpendicular_sign = alternating_traits<perpendicular_projection, parallel_projection, big_endian>::sign,
 			projection_sign    = +1,//alternating_traits<perpendicular_projection, hodge_complement, big_endian>::sign,
+			metric_sign        = metric_traits<parallel_projection, metric_type>::sign,
 		};
 	public:
 		enum : int
 		{
-			sign = hodge_sign * perpendicular_sign * projection_sign,
+			sign = hodge_sign * perpendicular_sign * projection_sign * metric_sign,
 		};
 		enum : size_t
 		{
@@ -222,5 +268,108 @@ namespace SBLib::Traits::Mathematics
 		};
 		static_assert(grade == bit_traits<mask>::population_count - bit_traits<parallel_projection>::population_count, "Incorrect grade!");
 	};
+
+
+	//
+	// Runtime blade signs
+	// Counterparts of alternating_traits and geometric_traits for blades only known at run time (c.f., sparse_multivector_t).
+	// The reordering sign is get_permutation_parity, in constant time. get_permutation_count keeps the full count.
+	//
+	template<bool big_endian = default_basis_big_endian>
+	inline constexpr size_t get_permutation_count(size_t first, size_t second)
+	{
+		size_t count = 0;
+		if (big_endian)
+			for (size_t shifted = (first >> 1); shifted != 0; shifted >>= 1)
+				count += get_population_count(shifted & second);
+		else
+			for (size_t shifted = (second >> 1); shifted != 0; shifted >>= 1)
+				count += get_population_count(shifted & first);
+		return count;
+	}
+	//
+	// get_permutation_parity_mask
+	// Vectors crossing an odd number of vectors of blade when reordering : the permutation parity of blade with any other
+	// blade b is popcount(b & mask) & 1, blade being the first operand if is_blade_first and the second one otherwise.
+	// With blade known at compile time (c.f., sparse_multivector.h), half of the sign folds into this constant mask.
+	//
+	template<bool big_endian = default_basis_big_endian>
+	inline constexpr size_t get_permutation_parity_mask(size_t blade, bool is_blade_first)
+	{
+		const size_t below_mask = size_t(get_prefix_parity_mask(blade));
+		const size_t above_mask = below_mask ^ blade ^ ((get_population_count(blade) & 1) != 0 ? ~size_t(0) : size_t(0));
+		return (big_endian == is_blade_first) ? above_mask : below_mask;
+	}
+	template<bool big_endian = default_basis_big_endian>
+	inline constexpr int get_alternating_sign(size_t first, size_t second)
+	{
+		return (first & second) != 0 ? 0 : get_permutation_parity<big_endian>(first, second) != 0 ? -1 : +1;
+	}
+	template<typename metric_type = euclidian_metric, bool big_endian = default_basis_big_endian>
+	inline constexpr int get_geometric_sign(size_t first, size_t second)
+	{
+		const size_t common = (first & second);
+		if ((common & metric_type::null_mask) != 0)
+			return 0;
+		const size_t parity = get_permutation_parity<big_endian>(first, second) ^ (get_population_count(common & metric_type::negative_mask) & 1);
+		return parity != 0 ? -1 : +1;
+	}
+
+	//
+	// get_blade_signs
+	// Signs of count blade pairs at once, as floats (e.g., rows of the runtime product tables). Pairs sharing a bit of zero_mask
+	// get 0 and every shared bit of negative_mask flips the sign : zero_mask = ~0 gives the wedge product signs, zero_mask and
+	// negative_mask = the null and negative masks of the metric give the geometric product ones.
+	// The AVX2 version handles 4 pairs per iteration, the prefix parity mask and the parity fold being shifts and xors only.
+	//
+	template<bool big_endian = default_basis_big_endian>
+	inline void get_blade_signs(float* signs, const size_t* firsts, const size_t* seconds, size_t count, size_t zero_mask, size_t negative_mask = 0)
+	{
+		size_t index = 0;
+#if defined(__AVX2__)
+		if constexpr (sizeof(size_t) == sizeof(long long))
+		{
+			const __m256i zero_masks     = _mm256_set1_epi64x((long long)zero_mask);
+			const __m256i negative_masks = _mm256_set1_epi64x((long long)negative_mask);
+			const __m256i ones           = _mm256_set1_epi64x(0x3F800000);
+			const __m256i one_bits       = _mm256_set1_epi64x(1);
+			const __m256i low_dwords     = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+			for (; index + 4 <= count; index += 4)
+			{
+				const __m256i first  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(firsts + index));
+				const __m256i second = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(seconds + index));
+				const __m256i common = _mm256_and_si256(first, second);
+
+				// c.f., get_prefix_parity_mask and get_permutation_parity
+				__m256i prefix = _mm256_slli_epi64(big_endian ? second : first, 1);
+				prefix = _mm256_xor_si256(prefix, _mm256_slli_epi64(prefix, 1));
+				prefix = _mm256_xor_si256(prefix, _mm256_slli_epi64(prefix, 2));
+				prefix = _mm256_xor_si256(prefix, _mm256_slli_epi64(prefix, 4));
+				prefix = _mm256_xor_si256(prefix, _mm256_slli_epi64(prefix, 8));
+				prefix = _mm256_xor_si256(prefix, _mm256_slli_epi64(prefix, 16));
+				prefix = _mm256_xor_si256(prefix, _mm256_slli_epi64(prefix, 32));
+				__m256i parity = _mm256_and_si256(big_endian ? first : second, prefix);
+				parity = _mm256_xor_si256(parity, _mm256_and_si256(common, negative_masks));
+				parity = _mm256_xor_si256(parity, _mm256_srli_epi64(parity, 32));
+				parity = _mm256_xor_si256(parity, _mm256_srli_epi64(parity, 16));
+				parity = _mm256_xor_si256(parity, _mm256_srli_epi64(parity, 8));
+				parity = _mm256_xor_si256(parity, _mm256_srli_epi64(parity, 4));
+				parity = _mm256_xor_si256(parity, _mm256_srli_epi64(parity, 2));
+				parity = _mm256_xor_si256(parity, _mm256_srli_epi64(parity, 1));
+
+				// +1.0f or -1.0f in the low dword of every lane, then 0.0f where a zero_mask bit is shared
+				__m256i bits = _mm256_or_si256(ones, _mm256_slli_epi64(_mm256_and_si256(parity, one_bits), 31));
+				bits = _mm256_and_si256(bits, _mm256_cmpeq_epi64(_mm256_and_si256(common, zero_masks), _mm256_setzero_si256()));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(signs + index), _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(bits, low_dwords)));
+			}
+		}
+#endif // #if defined(__AVX2__)
+		for (; index < count; ++index)
+		{
+			const size_t first = firsts[index], second = seconds[index], common = (first & second);
+			const size_t parity = get_permutation_parity<big_endian>(first, second) ^ (count_bits(common & negative_mask) & 1);
+			signs[index] = (common & zero_mask) != 0 ? 0.0f : parity != 0 ? -1.0f : +1.0f;
+		}
+	}
 } // namespace SBLib::Traits::Mathematics
 namespace SBLib { using namespace Traits::Mathematics; }
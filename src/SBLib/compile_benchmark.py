@@ -0,0 +1,250 @@
+"""
+Compile-time benchmark of the SBLib templates.
+
+Builds Mathematics/unit_tests/template_benchmark.cpp once per dimension (2 to 12 by default), which instantiates combinations,
+multivector_t, wedge_product and hodge_conjugate for every rank of that dimension, and records for each build :
+ - the compile time (best of --repeat builds) and the front-end / back-end split when the compiler reports it,
+ - the peak memory of the compiler process,
+ - with clang-cl, the template instantiation counts read from the -ftime-trace output.
+Results are written as a markdown report (--report) and as json (--json) ; passing a previous json as --baseline adds the
+relative changes to the report and returns 1 when any of them exceeds --threshold, so template changes can be checked for
+compile-time regressions :
+
+    python compile_benchmark.py --json before.json
+    (modify templates)
+    python compile_benchmark.py --baseline before.json --report report.md
+
+The compiler version and flags are stored along with the results, and the report warns when the baseline was built with
+different ones : a baseline only holds for the compiler it was measured with.
+
+Run it from a Visual Studio developer command prompt (so that cl.exe / clang-cl.exe and the standard headers are found).
+"""
+import argparse
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+SOLUTION_DIR     = os.path.dirname(os.path.abspath(__file__))
+BENCHMARK_SOURCE = os.path.join(SOLUTION_DIR, 'Mathematics', 'unit_tests', 'template_benchmark.cpp')
+COMMON_FLAGS     = ['/nologo', '/c', '/std:c++latest', '/EHsc', '/O2', '/I' + SOLUTION_DIR, '/DBENCHMARK_UNIT_TESTS']
+COMPILER_FLAGS   = {
+    'cl':       ['/Bt+', '/bigobj'],
+    'clang-cl': ['/clang:-ftime-trace', '/clang:-ftime-trace-granularity=0', '/clang:-ftemplate-depth=4096', '/bigobj'],
+}
+INSTANTIATION_EVENTS = ('InstantiateClass', 'InstantiateFunction')
+
+
+#
+# run_compiler
+# Runs one build and returns (exit code, output, elapsed seconds, peak memory in bytes or None).
+#
+def run_compiler(command, working_dir):
+    with tempfile.TemporaryFile(mode='w+') as output:
+        start = time.perf_counter()
+        process = subprocess.Popen(command, cwd=working_dir, stdout=output, stderr=subprocess.STDOUT, universal_newlines=True)
+        if os.name == 'nt':
+            process.wait()
+            elapsed = time.perf_counter() - start
+            peak_memory = get_windows_peak_memory(process)
+        else:
+            # wait4 returns the resource usage of this child alone (RUSAGE_CHILDREN would keep the maximum over all builds)
+            _, status, usage = os.wait4(process.pid, 0)
+            elapsed = time.perf_counter() - start
+            process.returncode = os.waitstatus_to_exitcode(status)
+            peak_memory = usage.ru_maxrss * (1 if sys.platform == 'darwin' else 1024)
+        output.seek(0)
+        return process.returncode, output.read(), elapsed, peak_memory
+
+
+def get_windows_peak_memory(process):
+    import ctypes
+    from ctypes import wintypes
+
+    class PROCESS_MEMORY_COUNTERS(ctypes.Structure):
+        _fields_ = [('cb', wintypes.DWORD), ('PageFaultCount', wintypes.DWORD),
+                    ('PeakWorkingSetSize', ctypes.c_size_t), ('WorkingSetSize', ctypes.c_size_t),
+                    ('QuotaPeakPagedPoolUsage', ctypes.c_size_t), ('QuotaPagedPoolUsage', ctypes.c_size_t),
+                    ('QuotaPeakNonPagedPoolUsage', ctypes.c_size_t), ('QuotaNonPagedPoolUsage', ctypes.c_size_t),
+                    ('PagefileUsage', ctypes.c_size_t), ('PeakPagefileUsage', ctypes.c_size_t)]
+
+    counters = PROCESS_MEMORY_COUNTERS()
+    counters.cb = ctypes.sizeof(counters)
+    get_process_memory_info = ctypes.WinDLL('psapi').GetProcessMemoryInfo
+    get_process_memory_info.argtypes = [wintypes.HANDLE, ctypes.POINTER(PROCESS_MEMORY_COUNTERS), wintypes.DWORD]
+    # the handle stays valid until the Popen object is released. cl.exe itself is a driver : the front-end and back-end
+    # are loaded in-process, so its peak working set is the one of the compiler.
+    if not get_process_memory_info(int(process._handle), ctypes.byref(counters), counters.cb):
+        return None
+    return counters.PeakWorkingSetSize
+
+
+#
+# parse_time_trace
+# Instantiation counts and front-end / back-end durations (seconds) from a clang -ftime-trace json file.
+#
+def parse_time_trace(path):
+    with open(path) as trace_file:
+        events = json.load(trace_file).get('traceEvents', [])
+    result = {name: 0 for name in INSTANTIATION_EVENTS}
+    for event in events:
+        name = event.get('name', '')
+        if event.get('ph') == 'X' and name in result:
+            result[name] += 1
+        elif name == 'Total Frontend':
+            result['frontend'] = event.get('dur', 0) * 1e-6
+        elif name == 'Total Backend':
+            result['backend'] = event.get('dur', 0) * 1e-6
+    return result
+
+
+#
+# parse_cl_times
+# Front-end (c1xx) and back-end (c2) durations printed by cl /Bt+.
+#
+def parse_cl_times(output):
+    result = {}
+    for dll, seconds in re.findall(r'time\(.*?(c1xx|c2)\.dll\)\s*=\s*([0-9.]+)s', output):
+        result['frontend' if dll == 'c1xx' else 'backend'] = float(seconds)
+    return result
+
+
+#
+# get_compiler_version
+# First line of the cl banner (printed when run without arguments) or of clang-cl --version, recorded along with the results :
+# timings of different compiler versions are not comparable.
+#
+def get_compiler_version(compiler):
+    is_cl = os.path.splitext(os.path.basename(compiler))[0].lower() == 'cl'
+    try:
+        process = subprocess.run([compiler] if is_cl else [compiler, '--version'], stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+    except OSError as error:
+        raise RuntimeError('cannot run %s : %s' % (compiler, error))
+    lines = [line.strip() for line in process.stdout.splitlines() if line.strip()]
+    return lines[0] if lines else 'unknown'
+
+
+def benchmark_dimension(compiler, dimension, wedge_rank, repeat, extra_flags):
+    build_dir = tempfile.mkdtemp(prefix='sblib_compile_benchmark_')
+    try:
+        object_path = os.path.join(build_dir, 'template_benchmark.obj')
+        command = [compiler] + COMMON_FLAGS + COMPILER_FLAGS.get(os.path.splitext(os.path.basename(compiler))[0].lower(), []) + extra_flags + [
+            '/DTEMPLATE_BENCHMARK_DIMENSION=%d' % dimension, '/DTEMPLATE_BENCHMARK_WEDGE_RANK=%d' % wedge_rank,
+            '/Fo' + object_path, BENCHMARK_SOURCE]
+        best = None
+        for _ in range(repeat):
+            exit_code, output, elapsed, peak_memory = run_compiler(command, build_dir)
+            if exit_code != 0:
+                raise RuntimeError('%dD build failed (%d) :\n%s\n%s' % (dimension, exit_code, ' '.join(command), output))
+            result = {'dimension': dimension, 'time': elapsed, 'memory': peak_memory, 'object_size': os.path.getsize(object_path)}
+            result.update(parse_cl_times(output))
+            trace_path = os.path.splitext(object_path)[0] + '.json'
+            if os.path.exists(trace_path):
+                result.update(parse_time_trace(trace_path))
+            if best is None or result['time'] < best['time']:
+                best = result
+        return best
+    finally:
+        shutil.rmtree(build_dir, ignore_errors=True)
+
+
+COLUMNS = [
+    # key, title, format
+    ('time',                'time (s)',              '%.2f'),
+    ('frontend',            'front-end (s)',         '%.2f'),
+    ('backend',             'back-end (s)',          '%.2f'),
+    ('memory',              'peak memory (MB)',      '%.0f'),
+    ('InstantiateClass',    'class instantiations',  '%d'),
+    ('InstantiateFunction', 'function instantiations', '%d'),
+    ('object_size',         'object size (KB)',      '%.0f'),
+]
+SCALES = {'memory': 1.0 / (1 << 20), 'object_size': 1.0 / (1 << 10)}
+
+
+def format_value(key, value, format_string):
+    return '-' if value is None else format_string % (value * SCALES.get(key, 1.0))
+
+
+def write_report(results, baseline, settings, threshold):
+    columns = [column for column in COLUMNS if any(result.get(column[0]) is not None for result in results)]
+    baseline_results = {result['dimension']: result for result in (baseline or {}).get('results', [])}
+    lines = ['# SBLib compile-time benchmark', '',
+             '%s (%s), flags "%s", wedge operand rank %d, best of %d build(s) of template_benchmark.cpp.' % (
+                 settings['compiler'], settings['compiler_version'], settings['flags'], settings['wedge_rank'], settings['repeat']), '']
+    baseline_settings = (baseline or {}).get('settings', {})
+    for key in ('compiler_version', 'flags', 'wedge_rank'):
+        if baseline is not None and baseline_settings.get(key) != settings[key]:
+            lines += ['Warning : the baseline %s differs (%s), changes below are not only those of the templates.' % (key, baseline_settings.get(key)), '']
+    lines.append('| dimension | ' + ' | '.join(title for _, title, _ in columns) + ' |')
+    lines.append('|---:|' + '---:|' * len(columns))
+    regressions = []
+    for result in results:
+        reference = baseline_results.get(result['dimension'], {})
+        cells = []
+        for key, _, format_string in columns:
+            cell = format_value(key, result.get(key), format_string)
+            if reference.get(key) and result.get(key) is not None:
+                change = result[key] / reference[key] - 1.0
+                cell += ' (%+.0f%%)' % (100.0 * change)
+                if change > threshold:
+                    regressions.append('%dD %s : %s -> %s' % (result['dimension'], key, format_value(key, reference[key], format_string), format_value(key, result[key], format_string)))
+            cells.append(cell)
+        lines.append('| %d | ' % result['dimension'] + ' | '.join(cells) + ' |')
+    if baseline is not None:
+        lines += ['', 'Relative changes against %s (threshold %+.0f%%) : %s' % (settings['baseline'], 100.0 * threshold, 'no regression' if not regressions else '%d regression(s)' % len(regressions))]
+        lines += ['- ' + regression for regression in regressions]
+    return '\n'.join(lines) + '\n', regressions
+
+
+def parse_dimensions(text):
+    if '-' in text:
+        first, last = text.split('-')
+        return list(range(int(first), int(last) + 1))
+    return [int(dimension) for dimension in text.split(',')]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument('--compiler', default=shutil.which('clang-cl') or 'cl', help='cl or clang-cl (default : clang-cl when found, for instantiation counts)')
+    parser.add_argument('--dimensions', default='2-12', help='range (2-12) or list (4,8,12) of space dimensions')
+    parser.add_argument('--wedge-rank', type=int, default=1, help='rank of the left wedge product operand')
+    parser.add_argument('--repeat', type=int, default=1, help='builds per dimension, the fastest one is kept')
+    parser.add_argument('--flags', default='', help='additional compiler flags')
+    parser.add_argument('--report', help='markdown report (default : standard output)')
+    parser.add_argument('--json', help='json results, usable as a later --baseline')
+    parser.add_argument('--baseline', help='json results of a previous run to compare against')
+    parser.add_argument('--threshold', type=float, default=0.10, help='relative increase reported as a regression')
+    arguments = parser.parse_args()
+
+    settings = {'compiler': arguments.compiler, 'compiler_version': get_compiler_version(arguments.compiler), 'flags': arguments.flags,
+                'wedge_rank': arguments.wedge_rank, 'repeat': arguments.repeat, 'baseline': arguments.baseline}
+    results = []
+    for dimension in parse_dimensions(arguments.dimensions):
+        if arguments.wedge_rank > dimension:
+            continue
+        result = benchmark_dimension(arguments.compiler, dimension, arguments.wedge_rank, arguments.repeat, arguments.flags.split())
+        print('%2dD : %.2fs' % (dimension, result['time']), file=sys.stderr)
+        results.append(result)
+
+    baseline = None
+    if arguments.baseline:
+        with open(arguments.baseline) as baseline_file:
+            baseline = json.load(baseline_file)
+    report, regressions = write_report(results, baseline, settings, arguments.threshold)
+    if arguments.report:
+        with open(arguments.report, 'w') as report_file:
+            report_file.write(report)
+    else:
+        sys.stdout.write(report)
+    if arguments.json:
+        with open(arguments.json, 'w') as json_file:
+            json.dump({'settings': settings, 'results': results}, json_file, indent=1)
+    return 1 if regressions else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -1,7 +1,11 @@
 #pragma once
 #define USE_DIRECTX_VECTOR 0
+#define USE_PREBUILT_ALGEBRA 0 // set to 1 to link the 2-D to 5-D float/double instantiations of SBLib_prebuilt.lib instead of instantiating them in every test (c.f., README.md)
 
 #include <Mathematics/multivector.h>
+#if USE_PREBUILT_ALGEBRA
+#include <Mathematics/prebuilt_algebra.h>
+#endif // #if USE_PREBUILT_ALGEBRA
 
 #include <functional>
 #include <iostream>